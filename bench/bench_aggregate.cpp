@@ -0,0 +1,101 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * Serialization of 500000 structs of 20 fields, a run of scalars with a padded nested struct and an array,
+ * followed by a string, in native and big-endian byte order into preallocated buffers.
+ */
+struct Padded {
+    int8_t a;
+    int64_t b;
+    int16_t c;
+};
+
+struct Wide {
+    int64_t time;
+    double price;
+    double quantity;
+    uint32_t id;
+    uint32_t flags;
+    int32_t a1;
+    int32_t a2;
+    float f1;
+    float f2;
+    int16_t s1;
+    int16_t s2;
+    int16_t s3;
+    int16_t s4;
+    uint8_t b1;
+    uint8_t b2;
+    uint8_t b3;
+    uint8_t b4;
+    double d2;
+    Padded padded;
+    std::array< uint16_t, 3 > array;
+    std::string name;
+};
+
+struct Table {
+    std::vector< Wide > rows;
+};
+
+SERIAL_TYPE_INFO( Padded )
+SERIAL_TYPE_INFO( Wide )
+SERIAL_TYPE_INFO( Table )
+
+using Clock = std::chrono::steady_clock;
+
+template< typename ByteArray >
+void measure( const char* name, const Table& table ) {
+
+    ByteArray bytes = memserial::serialize< ByteArray >( table );
+    Table value = table;
+    double best_serialize = 1e9;
+    double best_parse = 1e9;
+
+    for ( int repeat = 0; repeat < 10; ++repeat ) {
+        auto start = Clock::now();
+        memserial::serialize( bytes, table );
+        auto middle = Clock::now();
+        memserial::parse( value, bytes );
+        auto finish = Clock::now();
+
+        best_serialize = std::min( best_serialize, std::chrono::duration< double, std::milli >( middle - start ).count() );
+        best_parse = std::min( best_parse, std::chrono::duration< double, std::milli >( finish - middle ).count() );
+    }
+
+    if ( value.rows.size() != table.rows.size() || value.rows.back().array[ 2 ] != table.rows.back().array[ 2 ] )
+        std::exit( 1 );
+
+    std::printf( "%-10s %.1f MB: serialize %.1f ms, parse %.1f ms\n", name, bytes.size() / 1e6, best_serialize, best_parse );
+}
+
+int main() {
+
+    Table table;
+
+    for ( int index = 0; index < 500000; ++index ) {
+        table.rows.push_back( Wide{ index, index * 0.25, 3.5, uint32_t( index ), 7, -1, -2, 1.5f, 2.5f,
+            1, 2, 3, 4, 5, 6, 7, 8, 9.5, { 1, -2, 3 }, { 1, 2, uint16_t( index ) }, "nm" } );
+    }
+
+    measure< std::string >( "native", table );
+    measure< memserial::SerialWrapper< std::string, memserial::BigEndian > >( "big-endian", table );
+}
@@ -0,0 +1,141 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+/**
+ * Ratio and throughput of the block compressor on 64 KiB inputs of typical shapes,
+ * then plain and compressed frames of a batch of market data messages.
+ */
+struct Tick {
+    std::string symbol;
+    std::string venue;
+    std::vector< int64_t > levels;
+    std::array< double, 32 > book;
+    uint64_t sequence;
+    int32_t flags;
+};
+
+SERIAL_TYPE_INFO( Tick )
+
+using Clock = std::chrono::steady_clock;
+
+static void measure_block( const char* name, const std::string& data ) {
+
+    std::string compressed( memserial::detail::lz_bound( data.size() ), 0 );
+    std::string restored( data.size(), 0 );
+    std::size_t size = 0;
+    double best_compress = 1e9;
+    double best_decompress = 1e9;
+
+    for ( int repeat = 0; repeat < 200; ++repeat ) {
+        auto start = Clock::now();
+        size = memserial::detail::lz_compress( data.data(), data.size(), &compressed[ 0 ] );
+        auto middle = Clock::now();
+        memserial::detail::lz_decompress( compressed.data(), size, &restored[ 0 ], restored.size() );
+        auto finish = Clock::now();
+
+        best_compress = std::min( best_compress, std::chrono::duration< double, std::micro >( middle - start ).count() );
+        best_decompress = std::min( best_decompress, std::chrono::duration< double, std::micro >( finish - middle ).count() );
+    }
+
+    if ( restored != data )
+        std::exit( 1 );
+
+    std::printf( "%-12s ratio %6.1f, compress %7.0f MB/s, decompress %7.0f MB/s\n", name,
+        double( data.size() ) / size, data.size() / best_compress, data.size() / best_decompress );
+}
+
+static void measure_batch( const char* name, const std::vector< Tick >& ticks, uint8_t flags ) {
+
+    std::string bytes;
+    double best_append = 1e9;
+    double best_parse = 1e9;
+
+    for ( int repeat = 0; repeat < 30; ++repeat ) {
+        bytes.clear();
+
+        auto start = Clock::now();
+        for ( const auto& tick : ticks )
+            memserial::append( bytes, tick, flags );
+        auto middle = Clock::now();
+
+        std::size_t levels = 0;
+        for ( const auto& frame : memserial::SerialBatch<>( bytes ) )
+            levels += memserial::parse< Tick >( frame.bytes() ).levels.size();
+        auto finish = Clock::now();
+
+        if ( levels != ticks.size() * ticks.front().levels.size() )
+            std::exit( 1 );
+
+        best_append = std::min( best_append, std::chrono::duration< double, std::nano >( middle - start ).count() );
+        best_parse = std::min( best_parse, std::chrono::duration< double, std::nano >( finish - middle ).count() );
+    }
+
+    std::printf( "%-12s %zu bytes, append %.0f ns/msg, parse %.0f ns/msg\n", name, bytes.size(),
+        best_append / ticks.size(), best_parse / ticks.size() );
+}
+
+int main() {
+
+    const std::size_t block = 1 << 16;
+    std::mt19937 random( 1 );
+
+    std::string zeros( block, 0 );
+
+    std::string strings;
+    while ( strings.size() < block ) {
+        std::string name = "instrument-" + std::to_string( random() % 100 );
+        uint32_t length = uint32_t( name.size() );
+        strings.append( reinterpret_cast< const char* >( &length ), sizeof( length ) ).append( name );
+    }
+    strings.resize( block );
+
+    std::vector< int64_t > numbers( block / sizeof( int64_t ) );
+    for ( auto& number : numbers )
+        number = random() % 1000;
+    std::string integers( reinterpret_cast< const char* >( numbers.data() ), block );
+
+    std::string noise( block, 0 );
+    for ( auto& byte : noise )
+        byte = char( random() );
+
+    measure_block( "zeros", zeros );
+    measure_block( "strings", strings );
+    measure_block( "small ints", integers );
+    measure_block( "random", noise );
+
+    std::vector< Tick > ticks( 1000 );
+
+    for ( auto& tick : ticks ) {
+        tick.symbol = "EURUSD.SPOT.FX";
+        tick.venue = "LMAX-LONDON-LD4";
+        tick.levels.resize( 64 );
+        for ( auto& level : tick.levels )
+            level = random() % 16;
+        tick.book.fill( 0 );
+        for ( int index = 0; index < 4; ++index )
+            tick.book[ index ] = 1.0 + index * 0.0001;
+        tick.sequence = random();
+        tick.flags = 1;
+    }
+
+    measure_batch( "plain", ticks, 0 );
+    measure_batch( "compressed", ticks, memserial::CompressedFrame );
+}
@@ -0,0 +1,77 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <chrono>
+#include <cstdio>
+
+/**
+ * Decoding of nested vectors, every node holds a string and two vectors, one of them of aggregates with a string.
+ * Uses only serialize() and parse(), so the same source measures earlier revisions of the library.
+ */
+struct Leaf {
+    int32_t id;
+    double value;
+    std::string name;
+};
+
+struct Node {
+    std::string name;
+    std::vector< Leaf > leaves;
+    std::vector< uint32_t > ids;
+};
+
+struct Tree {
+    std::vector< Node > nodes;
+};
+
+SERIAL_TYPE_INFO( Leaf )
+SERIAL_TYPE_INFO( Node )
+SERIAL_TYPE_INFO( Tree )
+
+using Clock = std::chrono::steady_clock;
+
+int main() {
+
+    Tree tree;
+
+    for ( int index = 0; index < 40000; ++index ) {
+        Node node{ "node" + std::to_string( index ), {}, std::vector< uint32_t >( 16, uint32_t( index ) ) };
+        for ( int leaf = 0; leaf < 50; ++leaf )
+            node.leaves.push_back( Leaf{ leaf, leaf * 0.5, "leaf" } );
+        tree.nodes.push_back( std::move( node ) );
+    }
+
+    std::string bytes = memserial::serialize( tree );
+    double best_serialize = 1e9;
+    double best_parse = 1e9;
+
+    for ( int repeat = 0; repeat < 10; ++repeat ) {
+        auto start = Clock::now();
+        std::string written = memserial::serialize( tree );
+        auto middle = Clock::now();
+        Tree value = memserial::parse< Tree >( bytes );
+        auto finish = Clock::now();
+
+        if ( written != bytes || value.nodes.size() != tree.nodes.size() )
+            return 1;
+
+        best_serialize = std::min( best_serialize, std::chrono::duration< double, std::milli >( middle - start ).count() );
+        best_parse = std::min( best_parse, std::chrono::duration< double, std::milli >( finish - middle ).count() );
+    }
+
+    std::printf( "nested vectors, %.1f MB: serialize %.2f ms, parse %.2f ms (%.0f MB/s)\n",
+        bytes.size() / 1e6, best_serialize, best_parse, bytes.size() / 1e3 / best_parse );
+}
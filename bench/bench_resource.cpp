@@ -0,0 +1,91 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * Parsing of the same message into pmr containers on the global heap and on an arena released after every message,
+ * allocations reaching the global heap are counted by the resource in front of it.
+ */
+struct ResourceItem {
+    std::pmr::string name;
+    std::pmr::vector< int32_t > values;
+};
+
+struct ResourceMessage {
+    std::pmr::string title;
+    std::pmr::vector< ResourceItem > items;
+    std::pmr::vector< std::pmr::string > tags;
+};
+
+SERIAL_TYPE_INFO( ResourceItem )
+SERIAL_TYPE_INFO( ResourceMessage )
+
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+
+private:
+    void* do_allocate( std::size_t bytes, std::size_t alignment ) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+    }
+
+    void do_deallocate( void* data, std::size_t bytes, std::size_t alignment ) override {
+        std::pmr::new_delete_resource()->deallocate( data, bytes, alignment );
+    }
+
+    bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override {
+        return this == &other;
+    }
+};
+
+using Clock = std::chrono::steady_clock;
+
+int main() {
+
+    ResourceMessage message{ "a title that is long enough to allocate", {}, {} };
+
+    for ( int index = 0; index < 2000; ++index ) {
+        message.items.push_back( ResourceItem{ std::pmr::string( "item name number " + std::to_string( index ) ), { 1, 2, 3, index } } );
+        message.tags.emplace_back( "tag tag tag tag tag " + std::to_string( index ) );
+    }
+
+    std::string bytes = memserial::serialize( message );
+
+    const int count = 200;
+    CountingResource heap;
+    CountingResource upstream;
+    std::vector< char > buffer( 1 << 20 );
+    std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size(), &upstream );
+
+    auto start = Clock::now();
+    for ( int index = 0; index < count; ++index )
+        memserial::parse< ResourceMessage >( bytes, &heap );
+    auto middle = Clock::now();
+
+    for ( int index = 0; index < count; ++index ) {
+        memserial::parse< ResourceMessage >( bytes, &arena );
+        arena.release();
+    }
+    auto finish = Clock::now();
+
+    std::printf( "%zu bytes: global heap %.1f us, %zu allocations; arena %.1f us, %zu allocations per message\n", bytes.size(),
+        std::chrono::duration< double, std::micro >( middle - start ).count() / count, heap.allocations / count,
+        std::chrono::duration< double, std::micro >( finish - middle ).count() / count, upstream.allocations / count );
+}
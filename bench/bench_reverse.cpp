@@ -0,0 +1,75 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Bulk byte swap of 65536 elements by the per-element loop and by the kernel chosen at runtime.
+ */
+using Clock = std::chrono::steady_clock;
+
+template< typename T >
+void reverse_loop( T* dst, const T* src, std::size_t size ) {
+    for ( std::size_t index = 0; index < size; ++index )
+        dst[ index ] = memserial::detail::reverse_endian( src[ index ] );
+}
+
+template< typename T >
+void reverse_bulk( T* dst, const T* src, std::size_t size ) {
+    memserial::detail::reverse_endian( dst, src, size );
+}
+
+template< typename T >
+double measure( void ( *reverse )( T*, const T*, std::size_t ) ) {
+
+    std::vector< T > source( 1 << 16 );
+    std::vector< T > target( source.size() );
+    double best = 1e9;
+
+    for ( std::size_t index = 0; index < source.size(); ++index )
+        source[ index ] = T( index * 2654435761u );
+
+    for ( int repeat = 0; repeat < 100; ++repeat ) {
+        auto start = Clock::now();
+        reverse( target.data(), source.data(), source.size() );
+        auto finish = Clock::now();
+        asm volatile( "" :: "r"( target.data() ) : "memory" );
+        best = std::min( best, std::chrono::duration< double, std::micro >( finish - start ).count() );
+    }
+
+    std::vector< T > expected( source.size() );
+    reverse_loop( expected.data(), source.data(), source.size() );
+
+    if ( std::memcmp( expected.data(), target.data(), target.size() * sizeof( T ) ) != 0 )
+        std::exit( 1 );
+
+    return best;
+}
+
+template< typename T >
+void report( const char* name ) {
+    std::printf( "%-8s loop %7.1f us, kernel %7.1f us\n", name, measure< T >( reverse_loop< T > ), measure< T >( reverse_bulk< T > ) );
+}
+
+int main() {
+
+    report< uint16_t >( "uint16_t" );
+    report< uint32_t >( "uint32_t" );
+    report< double >( "double" );
+}
@@ -0,0 +1,419 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ *
+ */
+template< typename T, typename Iterator >
+struct ViewBase {
+    using ValueType = T;
+
+    Iterator data_begin;
+    Iterator data_end;
+
+    ViewBase( const Iterator& begin, const Iterator& end ) :
+            data_begin( begin ),
+            data_end( end ) {
+    }
+
+    ValueType value() const {
+        ValueType value{};
+        Iterator begin = data_begin;
+        Iterator end = data_end;
+        SharedScope scope;
+        SerialType< ValueType >::bin( value, begin, end );
+        return value;
+    }
+};
+
+/**
+ *
+ */
+template< typename T, typename Iterator, typename I = std::true_type >
+struct ViewType : ViewBase< T, Iterator > {
+    using ViewBase< T, Iterator >::ViewBase;
+};
+
+/**
+ *
+ */
+template< typename DataType, typename Iterator >
+struct RangeIterator {
+    using iterator_category = std::input_iterator_tag;
+    using value_type = DataType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = DataType;
+
+    Iterator data;
+
+    DataType operator*() const {
+        DataType value;
+        Iterator begin = data;
+        begin.bin( value );
+        return value;
+    }
+
+    RangeIterator& operator++() {
+        data += sizeof( DataType );
+        return *this;
+    }
+
+    RangeIterator operator++( int ) {
+        RangeIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    difference_type operator-( const RangeIterator& other ) const {
+        return ( data - other.data ) / difference_type( sizeof( DataType ) );
+    }
+
+    bool operator==( const RangeIterator& other ) const {
+        return data == other.data;
+    }
+
+    bool operator!=( const RangeIterator& other ) const {
+        return data != other.data;
+    }
+};
+
+/**
+ *
+ */
+template< typename T, typename DataType, typename Iterator >
+struct RangeView : ViewBase< T, Iterator > {
+    using iterator = RangeIterator< DataType, Iterator >;
+    using const_iterator = iterator;
+
+    Iterator data;
+    std::size_t count;
+
+    RangeView( const Iterator& begin, const Iterator& end, std::size_t size ) :
+            ViewBase< T, Iterator >( begin, end ),
+            data( begin ),
+            count( size ) {
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    DataType operator[]( std::size_t index ) const {
+        return *iterator{ Iterator( data + sizeof( DataType ) * index ) };
+    }
+
+    iterator begin() const {
+        return iterator{ data };
+    }
+
+    iterator end() const {
+        return iterator{ Iterator( data + sizeof( DataType ) * count ) };
+    }
+
+    void copy( DataType* value ) const {
+        if ( count == 0 )
+            return;
+        Iterator begin = data;
+        begin.bin( value, count );
+    }
+
+    /**
+     * Raw access is only available if elements are stored in native byte order.
+     */
+    static constexpr bool contiguous() {
+        return !endian_traits< Iterator::order, sizeof( DataType ) >::value;
+    }
+
+#if __cplusplus >= 201703L
+    std::basic_string_view< DataType > view() const {
+        static_assert( contiguous(), "elements are not stored in native byte order" );
+        if ( count == 0 )
+            return {};
+        return { reinterpret_cast< const DataType* >( &*data ), count };
+    }
+#endif
+};
+
+/**
+ *
+ */
+template< typename DataType, typename Iterator >
+struct SequenceIterator {
+    using iterator_category = std::input_iterator_tag;
+    using value_type = ViewType< DataType, Iterator >;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    Iterator data;
+    Iterator least_end;
+    std::size_t count;
+
+    value_type operator*() const {
+        return value_type( data, least_end + SerialType< DataType >::size() );
+    }
+
+    SequenceIterator& operator++() {
+        least_end += SerialType< DataType >::size();
+        SerialType< DataType >::skip( data, least_end );
+        --count;
+        return *this;
+    }
+
+    SequenceIterator operator++( int ) {
+        SequenceIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==( const SequenceIterator& other ) const {
+        return count == other.count;
+    }
+
+    bool operator!=( const SequenceIterator& other ) const {
+        return count != other.count;
+    }
+};
+
+/**
+ *
+ */
+template< typename T, typename DataType, typename Iterator >
+struct SequenceView : ViewBase< T, Iterator > {
+    using iterator = SequenceIterator< DataType, Iterator >;
+    using const_iterator = iterator;
+
+    Iterator data;
+    Iterator least_end;
+    std::size_t count;
+
+    SequenceView( const Iterator& begin, const Iterator& end, std::size_t size ) :
+            ViewBase< T, Iterator >( begin, end ),
+            data( begin ),
+            least_end( end - SerialType< DataType >::size() * size ),
+            count( size ) {
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    ViewType< DataType, Iterator > operator[]( std::size_t index ) const {
+        iterator it = begin();
+        for ( ; index > 0; --index )
+            ++it;
+        return *it;
+    }
+
+    iterator begin() const {
+        return iterator{ data, least_end, count };
+    }
+
+    iterator end() const {
+        return iterator{ data, least_end, 0 };
+    }
+};
+
+/**
+ *
+ */
+template< typename T, typename Iterator >
+struct ViewType< T, Iterator, is_serial< T > > : ViewBase< T, Iterator > {
+    template< std::size_t Index >
+    using FieldType = typename rebind_serial< T >::template tuple_field< Index >::FieldType;
+
+    using ViewBase< T, Iterator >::ViewBase;
+
+    template< std::size_t Index >
+    ViewType< FieldType< Index >, Iterator > get() const {
+        Iterator begin = this->data_begin;
+        Iterator least_end = this->data_end - SerialType< T >::size();
+        typename SerialType< T >::template SkipFunctor< Iterator > functor{ begin, least_end };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< Index >{} );
+        least_end += SerialType< FieldType< Index > >::size();
+        return ViewType< FieldType< Index >, Iterator >( begin, least_end );
+    }
+};
+
+/**
+ *
+ */
+template< typename Iterator, typename ... Args >
+struct ViewType< tuple< Args... >, Iterator, std::true_type > : ViewBase< tuple< Args... >, Iterator > {
+    using ValueType = tuple< Args... >;
+
+    template< std::size_t Index >
+    using FieldType = typename std::tuple_element< Index, ValueType >::type;
+
+    using ViewBase< ValueType, Iterator >::ViewBase;
+
+    template< std::size_t Index >
+    ViewType< FieldType< Index >, Iterator > get() const {
+        Iterator begin = this->data_begin;
+        Iterator least_end = this->data_end - SerialType< ValueType >::size();
+        typename SerialType< ValueType >::template SkipFunctor< Iterator > functor{ begin, least_end };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< Index >{} );
+        least_end += SerialType< FieldType< Index > >::size();
+        return ViewType< FieldType< Index >, Iterator >( begin, least_end );
+    }
+};
+
+/**
+ *
+ */
+template< typename Iterator, typename ... Args >
+struct ViewType< basic_string< Args... >, Iterator, is_primitive< typename basic_string< Args... >::value_type > > :
+        RangeView< basic_string< Args... >, typename basic_string< Args... >::value_type, Iterator > {
+    using ValueType = basic_string< Args... >;
+    using DataType = typename ValueType::value_type;
+    using SizeType = typename SerialType< ValueType >::SizeType;
+
+    ViewType( const Iterator& begin, const Iterator& end ) :
+            RangeView< ValueType, DataType, Iterator >( begin, end, prefix( begin, end ) ) {
+        this->data += sizeof( SizeType );
+    }
+
+    static std::size_t prefix( Iterator begin, const Iterator& end ) {
+        SizeType data_size;
+        begin.bin( data_size );
+        if ( size_overflow( begin, end, data_size, sizeof( DataType ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        return data_size;
+    }
+};
+
+/**
+ *
+ */
+template< typename Iterator, typename ... Args >
+struct ViewType< vector< Args... >, Iterator, is_primitive_element< typename vector< Args... >::value_type > > :
+        RangeView< vector< Args... >, typename vector< Args... >::value_type, Iterator > {
+    using ValueType = vector< Args... >;
+    using DataType = typename ValueType::value_type;
+    using SizeType = typename SerialType< ValueType >::SizeType;
+
+    ViewType( const Iterator& begin, const Iterator& end ) :
+            RangeView< ValueType, DataType, Iterator >( begin, end, prefix( begin, end ) ) {
+        this->data += sizeof( SizeType );
+    }
+
+    static std::size_t prefix( Iterator begin, const Iterator& end ) {
+        SizeType data_size;
+        begin.bin( data_size );
+        if ( size_overflow( begin, end, data_size, sizeof( DataType ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        return data_size;
+    }
+};
+
+/**
+ *
+ */
+template< typename Iterator, typename ... Args >
+struct ViewType< vector< Args... >, Iterator, is_class< typename vector< Args... >::value_type > > :
+        SequenceView< vector< Args... >, typename vector< Args... >::value_type, Iterator > {
+    using ValueType = vector< Args... >;
+    using DataType = typename ValueType::value_type;
+    using SizeType = typename SerialType< ValueType >::SizeType;
+
+    static constexpr std::size_t chunk = SerialType< ValueType >::chunk;
+
+    Iterator index;
+
+    ViewType( const Iterator& begin, const Iterator& end ) :
+            SequenceView< ValueType, DataType, Iterator >( begin, end, prefix( begin, end ) ),
+            index( begin ) {
+        this->data += sizeof( SizeType );
+        index += sizeof( SizeType );
+        std::size_t chunks = SerialType< ValueType >::chunks( this->count );
+        if ( size_overflow( this->data, this->least_end, chunks, sizeof( uint64_t ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        this->data += sizeof( uint64_t ) * chunks;
+    }
+
+    /**
+     * Vectors with offset index jump to the chunk of the element, so only elements of the chunk are skipped.
+     */
+    ViewType< DataType, Iterator > operator[]( std::size_t position ) const {
+        typename SequenceView< ValueType, DataType, Iterator >::iterator it = this->begin();
+        if ( SerialType< ValueType >::chunks( this->count ) != 0 && position >= chunk ) {
+            std::size_t first = position / chunk * chunk;
+            Iterator offset_begin = index;
+            offset_begin += sizeof( uint64_t ) * ( position / chunk - 1 );
+            uint64_t offset;
+            offset_begin.bin( offset );
+            it.least_end += SerialType< DataType >::size() * first;
+            if ( offset > uint64_t( std::distance( this->data, it.least_end ) ) )
+                throw SerialException( SerialException::ExcBufferOverflow );
+            it.data += std::size_t( offset );
+            it.count -= first;
+            position -= first;
+        }
+        for ( ; position > 0; --position )
+            ++it;
+        return *it;
+    }
+
+    static std::size_t prefix( Iterator begin, const Iterator& end ) {
+        SizeType data_size;
+        begin.bin( data_size );
+        if ( size_overflow( begin, end, data_size, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        return data_size;
+    }
+};
+
+/**
+ *
+ */
+template< typename Iterator, typename Arg, std::size_t Dim >
+struct ViewType< array< Arg, Dim >, Iterator, is_primitive< typename array< Arg, Dim >::value_type > > :
+        RangeView< array< Arg, Dim >, typename array< Arg, Dim >::value_type, Iterator > {
+    using ValueType = array< Arg, Dim >;
+    using DataType = typename ValueType::value_type;
+
+    ViewType( const Iterator& begin, const Iterator& end ) :
+            RangeView< ValueType, DataType, Iterator >( begin, end, Dim ) {
+    }
+};
+
+/**
+ *
+ */
+template< typename Iterator, typename Arg, std::size_t Dim >
+struct ViewType< array< Arg, Dim >, Iterator, is_class< typename array< Arg, Dim >::value_type > > :
+        SequenceView< array< Arg, Dim >, typename array< Arg, Dim >::value_type, Iterator > {
+    using ValueType = array< Arg, Dim >;
+    using DataType = typename ValueType::value_type;
+
+    ViewType( const Iterator& begin, const Iterator& end ) :
+            SequenceView< ValueType, DataType, Iterator >( begin, end, Dim ) {
+    }
+};
+
+}} // --- namespace
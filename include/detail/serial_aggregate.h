@@ -17,6 +17,22 @@
 namespace memserial {
 namespace detail {
 
+/**
+ * Size of the byte order unit of a fixed-size field, zero if the field consists of different units.
+ */
+template< typename T, typename I = std::true_type >
+struct rebind_unit {
+    static constexpr std::size_t value = 0;
+};
+
+template< typename T >
+struct rebind_unit< T, is_primitive< T > > {
+    static constexpr std::size_t value = sizeof( T ) <= sizeof( uint64_t ) ? sizeof( T ) : 0;
+};
+
+template< typename Arg, std::size_t Dim >
+struct rebind_unit< array< Arg, Dim >, is_primitive< Arg > > : rebind_unit< Arg > {};
+
 /**
  *
  */
@@ -72,11 +88,85 @@ struct SerialType< T, is_serial< T > > {
         return functor.size;
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        FixedFunctor functor{ true };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
+        return functor.fixed;
+    }
+
+    /**
+     * The object is copied as a whole if all fields are copied as is and there is no padding between them.
+     */
+    static constexpr bool trivial() {
+
+        TrivialFunctor functor{ true, 0 };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
+        return std::is_trivially_copyable< ValueType >::value && functor.trivial && functor.size == sizeof( ValueType );
+    }
+
+    /**
+     * Adjacent fixed-size fields without padding between them form a run, which is copied at once.
+     * In native byte order any trivial fields are joined, otherwise only fields with the same byte order unit.
+     * Fields in compact encoding are never joined, since integers have no fixed width.
+     */
+    struct CopyRun {
+        bool joined;
+        std::size_t size;
+        std::size_t unit;
+    };
+
+    template< typename Iterator, std::size_t Index >
+    static constexpr CopyRun copy_run() {
+
+        if ( Iterator::coding != FixedEncoding )
+            return CopyRun{ false, sizeof( FieldType< Index > ), 0 };
+
+        return make_run( Iterator::native, Index, std::make_index_sequence< tuple_size >{} );
+    }
+
+    template< std::size_t ... Index >
+    static constexpr CopyRun make_run( bool native, std::size_t field, std::index_sequence< Index... > ) {
+
+        const std::size_t sizes[] = { sizeof( FieldType< Index > )..., 0 };
+        const std::size_t aligns[] = { alignof( FieldType< Index > )..., 1 };
+        const std::size_t units[] = { ( native ?
+                std::size_t( SerialType< FieldType< Index > >::trivial() ) :
+                sizeof( FieldType< Index > ) == SerialType< FieldType< Index > >::size() ?
+                rebind_unit< FieldType< Index > >::value : 0 )..., 0 };
+
+        CopyRun run{ false, 0, 0 };
+        std::size_t offset = 0;
+
+        for ( std::size_t index = 0; index < tuple_size; ++index ) {
+            std::size_t aligned = ( offset + aligns[ index ] - 1 ) / aligns[ index ] * aligns[ index ];
+            bool joined = index != 0 && units[ index ] != 0 && units[ index ] == units[ index - 1 ] && aligned == offset;
+            offset = aligned + sizes[ index ];
+
+            if ( index == field ) {
+                run = CopyRun{ joined, sizes[ index ], units[ index ] };
+            }
+            else if ( index > field ) {
+                if ( !joined )
+                    break;
+                run.size += sizes[ index ];
+            }
+        }
+
+        return run;
+    }
+
     /**
      *
      */
     static std::size_t size( const ValueType& value ) {
 
+        if ( fixed() )
+            return size();
+
         SizeFunctor functor{ const_cast< ValueType& >( value ), 0 };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
         return functor.size;
@@ -86,10 +176,14 @@ struct SerialType< T, is_serial< T > > {
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        if ( trivial() && Iterator::native ) {
+            begin.bout( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+            return;
+        }
 
-        Iterator least_end = end - size();
-        InitFunctor< Iterator > functor{ value, begin, least_end };
+        BoutFunctor< Iterator > functor{ const_cast< ValueType& >( value ), begin };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
     }
 
@@ -97,9 +191,15 @@ struct SerialType< T, is_serial< T > > {
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
-        BoutFunctor< Iterator > functor{ const_cast< ValueType& >( value ), begin };
+        if ( trivial() && Iterator::native ) {
+            begin.bin( reinterpret_cast< char* >( &value ), sizeof( ValueType ) );
+            return;
+        }
+
+        Iterator least_end = end - Iterator::least( size() );
+        BinFunctor< Iterator > functor{ value, begin, least_end };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
     }
 
@@ -107,9 +207,58 @@ struct SerialType< T, is_serial< T > > {
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        Iterator least_end = end - Iterator::least( size() );
+        SkipFunctor< Iterator > functor{ begin, least_end };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
+    }
+
+    /**
+     * Only the listed fields are decoded, fields before them are skipped by their sizes and length prefixes,
+     * fields after the last listed one are not read.
+     */
+    template< std::size_t ... Fields, typename Iterator >
+    static void bin_fields( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        static_assert( sizeof...( Fields ) != 0, "no fields to decode" );
+        static_assert( fields_last< Fields... >() < tuple_size, "field index is out of range" );
+
+        Iterator least_end = end - Iterator::least( size() );
+        FieldsFunctor< Iterator, Fields... > functor{ value, begin, least_end };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< fields_last< Fields... >() + 1 >{} );
+    }
+
+    template< std::size_t ... Fields >
+    static constexpr std::size_t fields_last() {
+
+        const std::size_t fields[] = { Fields... };
+        std::size_t last = 0;
+
+        for ( std::size_t field : fields )
+            last = field > last ? field : last;
+
+        return last;
+    }
+
+    template< std::size_t ... Fields >
+    static constexpr bool fields_contain( std::size_t index ) {
+
+        const std::size_t fields[] = { Fields... };
+
+        for ( std::size_t field : fields )
+            if ( field == index )
+                return true;
 
-        BinFunctor< Iterator > functor{ value, begin };
+        return false;
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        ScanFunctor functor{ program };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
     }
 
@@ -173,6 +322,32 @@ struct SerialType< T, is_serial< T > > {
         }
     };
 
+    /**
+     *
+     */
+    struct TrivialFunctor {
+        bool trivial;
+        std::size_t size;
+
+        template< std::size_t Index >
+        constexpr void operator()( size_t_< Index > ) {
+            trivial = trivial && SerialType< FieldType< Index > >::trivial();
+            size += sizeof( FieldType< Index > );
+        }
+    };
+
+    /**
+     *
+     */
+    struct FixedFunctor {
+        bool fixed;
+
+        template< std::size_t Index >
+        constexpr void operator()( size_t_< Index > ) {
+            fixed = fixed && SerialType< FieldType< Index > >::fixed();
+        }
+    };
+
     /**
      *
      */
@@ -190,15 +365,25 @@ struct SerialType< T, is_serial< T > > {
      *
      */
     template< typename Iterator >
-    struct InitFunctor {
+    struct BoutFunctor {
         ValueType& value;
         Iterator& begin;
-        Iterator& end;
 
         template< std::size_t Index >
         constexpr void operator()( size_t_< Index > ) {
-            end += SerialType< FieldType< Index > >::size();
-            SerialType< FieldType< Index > >::init( tuple_field< Index >::get( value ), begin, end );
+            constexpr CopyRun run = copy_run< Iterator, Index >();
+            using UnitType = typename reversible_traits< run.unit == 0 ? 1 : run.unit >::ReversibleType;
+
+            if ( run.joined )
+                return;
+
+            if ( run.size > sizeof( FieldType< Index > ) ) {
+                auto data = reinterpret_cast< const UnitType* >( &tuple_field< Index >::get( value ) );
+                begin.bout( data, run.size / sizeof( UnitType ) );
+                return;
+            }
+
+            SerialType< FieldType< Index > >::bout( tuple_field< Index >::get( value ), begin );
         }
     };
 
@@ -206,13 +391,28 @@ struct SerialType< T, is_serial< T > > {
      *
      */
     template< typename Iterator >
-    struct BoutFunctor {
+    struct BinFunctor {
         ValueType& value;
         Iterator& begin;
+        Iterator& end;
 
         template< std::size_t Index >
         constexpr void operator()( size_t_< Index > ) {
-            SerialType< FieldType< Index > >::bout( tuple_field< Index >::get( value ), begin );
+            constexpr CopyRun run = copy_run< Iterator, Index >();
+            using UnitType = typename reversible_traits< run.unit == 0 ? 1 : run.unit >::ReversibleType;
+
+            end += Iterator::least( SerialType< FieldType< Index > >::size() );
+
+            if ( run.joined )
+                return;
+
+            if ( run.size > sizeof( FieldType< Index > ) ) {
+                auto data = reinterpret_cast< UnitType* >( &tuple_field< Index >::get( value ) );
+                begin.bin( data, run.size / sizeof( UnitType ) );
+                return;
+            }
+
+            SerialType< FieldType< Index > >::bin( tuple_field< Index >::get( value ), begin, end );
         }
     };
 
@@ -220,13 +420,46 @@ struct SerialType< T, is_serial< T > > {
      *
      */
     template< typename Iterator >
-    struct BinFunctor {
+    struct SkipFunctor {
+        Iterator& begin;
+        Iterator& end;
+
+        template< std::size_t Index >
+        constexpr void operator()( size_t_< Index > ) {
+            end += Iterator::least( SerialType< FieldType< Index > >::size() );
+            SerialType< FieldType< Index > >::skip( begin, end );
+        }
+    };
+
+    /**
+     *
+     */
+    template< typename Iterator, std::size_t ... Fields >
+    struct FieldsFunctor {
         ValueType& value;
         Iterator& begin;
+        Iterator& end;
+
+        template< std::size_t Index >
+        constexpr void operator()( size_t_< Index > ) {
+            end += Iterator::least( SerialType< FieldType< Index > >::size() );
+
+            if ( fields_contain< Fields... >( Index ) )
+                SerialType< FieldType< Index > >::bin( tuple_field< Index >::get( value ), begin, end );
+            else
+                SerialType< FieldType< Index > >::skip( begin, end );
+        }
+    };
+
+    /**
+     *
+     */
+    struct ScanFunctor {
+        ScanProgram& program;
 
         template< std::size_t Index >
         constexpr void operator()( size_t_< Index > ) {
-            SerialType< FieldType< Index > >::bin( tuple_field< Index >::get( value ), begin );
+            SerialType< FieldType< Index > >::scan( program );
         }
     };
 
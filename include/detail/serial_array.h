@@ -65,6 +65,22 @@ struct SerialType< array< Arg, Dim >, is_primitive< typename array< Arg, Dim >::
         return sizeof( DataType ) * Dim;
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return true;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return sizeof( ValueType ) == size();
+    }
+
     /**
      *
      */
@@ -77,27 +93,35 @@ struct SerialType< array< Arg, Dim >, is_primitive< typename array< Arg, Dim >::
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
 
-        begin += size();
+        begin.bout( &value[ 0 ], Dim );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
-        begin.bout( &value[ 0 ], Dim );
+        begin.bin( &value[ 0 ], Dim, end );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        begin.template skip< DataType >( Dim, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
 
-        begin.bin( &value[ 0 ], Dim );
+        program.bytes( size() );
     }
 
     /**
@@ -173,11 +197,30 @@ struct SerialType< array< Arg, Dim >, is_class< typename array< Arg, Dim >::valu
         return SerialType< DataType >::size() * Dim;
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return SerialType< DataType >::fixed();
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return SerialType< DataType >::trivial() && sizeof( ValueType ) == size();
+    }
+
     /**
      *
      */
     static std::size_t size( const ValueType& value ) {
 
+        if ( fixed() )
+            return size();
+
         std::size_t byte_size = 0;
 
         for ( const auto& data : value )
@@ -190,13 +233,33 @@ struct SerialType< array< Arg, Dim >, is_class< typename array< Arg, Dim >::valu
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
 
-        Iterator least_end = end - size();
+        if ( trivial() && Iterator::native ) {
+            begin.bout( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+            return;
+        }
+
+        for ( const auto& data : value )
+            SerialType< DataType >::bout( data, begin );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        if ( trivial() && Iterator::native ) {
+            begin.bin( reinterpret_cast< char* >( &value ), sizeof( ValueType ) );
+            return;
+        }
+
+        Iterator least_end = end - Iterator::least( size() );
 
         for ( auto& data : value ) {
-            least_end += SerialType< DataType >::size();
-            SerialType< DataType >::init( data, begin, least_end );
+            least_end += Iterator::least( SerialType< DataType >::size() );
+            SerialType< DataType >::bin( data, begin, least_end );
         }
     }
 
@@ -204,20 +267,22 @@ struct SerialType< array< Arg, Dim >, is_class< typename array< Arg, Dim >::valu
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
 
-        for ( const auto& data : value )
-            SerialType< DataType >::bout( data, begin );
+        Iterator least_end = end - Iterator::least( size() );
+
+        for ( std::size_t index = 0; index < Dim; ++index ) {
+            least_end += Iterator::least( SerialType< DataType >::size() );
+            SerialType< DataType >::skip( begin, least_end );
+        }
     }
 
     /**
      *
      */
-    template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void scan( ScanProgram& program ) {
 
-        for ( auto& data : value )
-            SerialType< DataType >::bin( data, begin );
+        program.repeat< DataType >( Dim );
     }
 
     /**
@@ -0,0 +1,314 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Element of a set is the key itself.
+ */
+template< typename Key, typename Data >
+struct associative_item {
+    using DataType = Key;
+
+    static const Key& key( const Data& item ) {
+        return item;
+    }
+
+    static std::size_t size( const Data& item ) {
+        return SerialType< DataType >::size( item );
+    }
+
+    template< typename Iterator >
+    static void bout( const Data& item, Iterator& begin ) {
+        SerialType< DataType >::bout( item, begin );
+    }
+
+    template< typename Stream >
+    static void debug( const Data& item, Stream& stream, uint8_t level ) {
+        SerialType< DataType >::debug( item, stream, level );
+    }
+};
+
+/**
+ * Element of a map is written as pair of the key and the mapped value.
+ */
+template< typename Key, typename Mapped >
+struct associative_item< Key, pair< const Key, Mapped > > {
+    using DataType = pair< Key, Mapped >;
+
+    static const Key& key( const pair< const Key, Mapped >& item ) {
+        return item.first;
+    }
+
+    static std::size_t size( const pair< const Key, Mapped >& item ) {
+        return SerialType< Key >::size( item.first ) + SerialType< Mapped >::size( item.second );
+    }
+
+    template< typename Iterator >
+    static void bout( const pair< const Key, Mapped >& item, Iterator& begin ) {
+        SerialType< Key >::bout( item.first, begin );
+        SerialType< Mapped >::bout( item.second, begin );
+    }
+
+    template< typename Stream >
+    static void debug( const pair< const Key, Mapped >& item, Stream& stream, uint8_t level ) {
+        SerialType< Key >::debug( item.first, stream, level );
+        stream << " => ";
+        SerialType< Mapped >::debug( item.second, stream, level );
+    }
+};
+
+/**
+ * Associative container is written as length prefix followed by elements in the order of iteration,
+ * ordered containers are rebuilt by insertion at the end, unordered ones are reserved before insertion.
+ */
+template< typename T, bool Ordered >
+struct SerialAssociative {
+    using ValueType = T;
+    using SizeType = typename rebind_size< ValueType >::SizeType;
+    using ItemType = associative_item< typename ValueType::key_type, typename ValueType::value_type >;
+    using DataType = typename ItemType::DataType;
+
+    static constexpr bool canonical = !Ordered && rebind_canonical< ValueType >::value;
+
+    static_assert( std::is_integral< SizeType >::value && std::is_unsigned< SizeType >::value,
+        "length prefix must be an unsigned integer" );
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        hash_combine( value, serial_traits< ValueType >::internal_ident );
+        SerialType< SizeType >::hash( value, nesting );
+        SerialType< DataType >::hash( value, nesting );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return sizeof( SizeType );
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        if ( SerialType< DataType >::fixed() )
+            return sizeof( SizeType ) + SerialType< DataType >::size() * value.size();
+
+        std::size_t byte_size = sizeof( SizeType );
+
+        for ( const auto& item : value )
+            byte_size += ItemType::size( item );
+
+        return byte_size;
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        begin.bout( SizeType( value.size() ) );
+        bout_items( value, begin, std::integral_constant< bool, canonical >{} );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        SizeType data_size;
+        begin.bin( data_size, end );
+
+        if ( size_overflow( begin, end, data_size, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        rebind_resource< ValueType >::apply( value );
+        value.clear();
+        reserve( value, data_size, std::integral_constant< bool, Ordered >{} );
+
+        Iterator least_end = end - Iterator::least( SerialType< DataType >::size() ) * data_size;
+
+        for ( SizeType index = 0; index < data_size; ++index ) {
+            least_end += Iterator::least( SerialType< DataType >::size() );
+
+            DataType data{};
+            SerialType< DataType >::bin( data, begin, least_end );
+            value.emplace_hint( value.end(), std::move( data ) );
+        }
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        SizeType data_size;
+        begin.bin( data_size, end );
+
+        if ( size_overflow( begin, end, data_size, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        Iterator least_end = end - Iterator::least( SerialType< DataType >::size() ) * data_size;
+
+        for ( SizeType index = 0; index < data_size; ++index ) {
+            least_end += Iterator::least( SerialType< DataType >::size() );
+            SerialType< DataType >::skip( begin, least_end );
+        }
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.sequence< DataType >( sizeof( SizeType ) );
+    }
+
+    /**
+     *
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data <<
+                "< " << SerialMetatype< DataType >::alias().data <<
+                " >[" << value.size() << "]: ";
+
+        if ( value.empty() ) {
+            stream << "empty";
+            return;
+        }
+
+        std::string separator = std::string( ", " );
+
+        for ( auto item = value.begin(); item != value.end(); ++item ) {
+            if ( item != value.begin() )
+                stream << separator.c_str();
+            ItemType::debug( *item, stream, level + 1 );
+        }
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout_items( const ValueType& value, Iterator& begin, std::false_type ) {
+
+        for ( const auto& item : value )
+            ItemType::bout( item, begin );
+    }
+
+    /**
+     * Elements are sorted by keys, so the bytes do not depend on the order of iteration.
+     */
+    template< typename Iterator >
+    static void bout_items( const ValueType& value, Iterator& begin, std::true_type ) {
+
+        std::vector< const typename ValueType::value_type* > items;
+        items.reserve( value.size() );
+
+        for ( const auto& item : value )
+            items.push_back( &item );
+
+        std::sort( items.begin(), items.end(), []( const auto* lhs, const auto* rhs ) {
+            return std::less< typename ValueType::key_type >()( ItemType::key( *lhs ), ItemType::key( *rhs ) );
+        } );
+
+        for ( const auto* item : items )
+            ItemType::bout( *item, begin );
+    }
+
+    static void reserve( ValueType& value, std::size_t size, std::true_type ) {
+    }
+
+    static void reserve( ValueType& value, std::size_t size, std::false_type ) {
+
+        value.reserve( size );
+    }
+};
+
+/**
+ *
+ */
+template< typename ... Args >
+struct SerialType< map< Args... >, std::true_type > : SerialAssociative< map< Args... >, true > {};
+
+/**
+ *
+ */
+template< typename ... Args >
+struct SerialType< set< Args... >, std::true_type > : SerialAssociative< set< Args... >, true > {};
+
+/**
+ *
+ */
+template< typename ... Args >
+struct SerialType< unordered_map< Args... >, std::true_type > : SerialAssociative< unordered_map< Args... >, false > {};
+
+/**
+ *
+ */
+template< typename ... Args >
+struct SerialType< unordered_set< Args... >, std::true_type > : SerialAssociative< unordered_set< Args... >, false > {};
+
+}} // --- namespace
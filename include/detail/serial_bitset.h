@@ -17,6 +17,76 @@
 namespace memserial {
 namespace detail {
 
+/**
+ * Bits are written least significant first, eight bits per byte, so the bytes of every 64-bit word
+ * are in little-endian order. Words are packed into a block on the stack, which is written at once.
+ */
+struct bits_traits {
+    static constexpr std::size_t word_bits = 64;
+    static constexpr std::size_t block_size = 512;
+
+    static constexpr std::size_t bytes( uint64_t bits ) {
+
+        return std::size_t( bits / CHAR_BIT + ( bits % CHAR_BIT == 0 ? 0 : 1 ) );
+    }
+
+    static void put( uint64_t word, char* data, std::size_t size ) {
+
+        for ( std::size_t index = 0; index < size; ++index )
+            data[ index ] = char( word >> ( index * CHAR_BIT ) );
+    }
+
+    static uint64_t get( const char* data, std::size_t size ) {
+
+        uint64_t word = 0;
+
+        for ( std::size_t index = 0; index < size; ++index )
+            word |= uint64_t( uint8_t( data[ index ] ) ) << ( index * CHAR_BIT );
+
+        return word;
+    }
+
+    /**
+     * Words are requested by index, the bits past the size in the last word must be zero.
+     */
+    template< typename Iterator, typename Func >
+    static void bout( std::size_t bits, Iterator& begin, Func word ) {
+
+        char data[ block_size ];
+        std::size_t byte_size = bytes( bits );
+
+        for ( std::size_t offset = 0; offset < byte_size; offset += block_size ) {
+            std::size_t size = std::min( std::size_t( block_size ), byte_size - offset );
+            for ( std::size_t index = 0; index < size; index += sizeof( uint64_t ) )
+                put( word( ( offset + index ) / sizeof( uint64_t ) ), data + index,
+                        std::min( sizeof( uint64_t ), size - index ) );
+            begin.bout( data, size );
+        }
+    }
+
+    /**
+     * Bits past the size in the last byte are cleared, so any data gives a valid value.
+     */
+    template< typename Iterator, typename Func >
+    static void bin( std::size_t bits, Iterator& begin, Iterator& end, Func word ) {
+
+        char data[ block_size ];
+        std::size_t byte_size = bytes( bits );
+
+        for ( std::size_t offset = 0; offset < byte_size; offset += block_size ) {
+            std::size_t size = std::min( std::size_t( block_size ), byte_size - offset );
+            begin.bin( data, size, end );
+            for ( std::size_t index = 0; index < size; index += sizeof( uint64_t ) ) {
+                std::size_t position = ( offset + index ) / sizeof( uint64_t );
+                uint64_t value = get( data + index, std::min( sizeof( uint64_t ), size - index ) );
+                if ( bits - position * word_bits < word_bits )
+                    value &= ( uint64_t( 1 ) << ( bits - position * word_bits ) ) - 1;
+                word( position, value );
+            }
+        }
+    }
+};
+
 /**
  *
  */
@@ -57,6 +127,55 @@ struct SerialType< bitset< Bits >, std::true_type > {
         return bytes_count;
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return true;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     * Checks once whether the bitset stores bits least significant first, eight bits per byte,
+     * then its bytes are the serialized data. Standard libraries keep bits in arrays of words,
+     * which have this layout on little-endian platforms.
+     */
+    static bool packed() {
+
+        static const bool packed_layout = [] {
+            if ( !std::is_trivially_copyable< ValueType >::value || sizeof( ValueType ) < size() )
+                return false;
+
+            for ( std::size_t bit : { std::size_t( 0 ), std::size_t( 9 ), std::size_t( 31 ), std::size_t( 32 ),
+                    std::size_t( 63 ), std::size_t( 64 ), Bits - 1 } ) {
+                if ( bit >= Bits )
+                    continue;
+
+                ValueType value;
+                value.set( bit );
+
+                unsigned char data[ sizeof( ValueType ) ];
+                std::memcpy( data, &value, sizeof( ValueType ) );
+
+                for ( std::size_t index = 0; index < sizeof( ValueType ); ++index )
+                    if ( data[ index ] != ( index == bit / CHAR_BIT ? 1u << ( bit % CHAR_BIT ) : 0u ) )
+                        return false;
+            }
+
+            return true;
+        }();
+
+        return packed_layout;
+    }
+
     /**
      *
      */
@@ -66,36 +185,74 @@ struct SerialType< bitset< Bits >, std::true_type > {
     }
 
     /**
-     *
+     * Bitsets up to 64 bits are converted through an integer, larger ones are copied as bytes
+     * if their layout allows it, otherwise words are gathered bit by bit.
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
 
-        begin += size();
+        if ( Bits <= bits_traits::word_bits ) {
+            bits_traits::bout( Bits, begin, [ & ]( std::size_t ) {
+                return uint64_t( value.to_ullong() );
+            } );
+            return;
+        }
+
+        if ( packed() ) {
+            begin.bout( reinterpret_cast< const char* >( &value ), size() );
+            return;
+        }
+
+        bits_traits::bout( Bits, begin, [ & ]( std::size_t index ) {
+            uint64_t word = 0;
+            for ( std::size_t bit = 0; bit < bits_traits::word_bits && index * bits_traits::word_bits + bit < Bits; ++bit )
+                word |= uint64_t( value[ index * bits_traits::word_bits + bit ] ) << bit;
+            return word;
+        } );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
-        for ( std::size_t index = 0; index < Bits; ++index )
-            begin[ index / CHAR_BIT ] |= ( value[ index ] << ( index % CHAR_BIT ) );
+        if ( Bits <= bits_traits::word_bits ) {
+            bits_traits::bin( Bits, begin, end, [ & ]( std::size_t, uint64_t word ) {
+                value = ValueType( static_cast< unsigned long long >( word ) );
+            } );
+            return;
+        }
 
-        begin += size();
+        if ( packed() ) {
+            value.reset();
+            begin.bin( reinterpret_cast< char* >( &value ), size(), end );
+            if ( Bits % CHAR_BIT != 0 )
+                reinterpret_cast< unsigned char* >( &value )[ size() - 1 ] &= ( 1u << ( Bits % CHAR_BIT ) ) - 1;
+            return;
+        }
+
+        bits_traits::bin( Bits, begin, end, [ & ]( std::size_t index, uint64_t word ) {
+            for ( std::size_t bit = 0; bit < bits_traits::word_bits && index * bits_traits::word_bits + bit < Bits; ++bit )
+                value[ index * bits_traits::word_bits + bit ] = ( ( word >> bit ) & 1 ) != 0;
+        } );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        begin.template skip< uint8_t >( size(), end );
+    }
 
-        for ( std::size_t index = 0; index < Bits; ++index )
-            value[ index ] = ( ( begin[ index / CHAR_BIT ] >> ( index % CHAR_BIT ) ) & 1 );
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
 
-        begin += size();
+        program.bytes( size() );
     }
 
     /**
@@ -110,4 +267,168 @@ struct SerialType< bitset< Bits >, std::true_type > {
     }
 };
 
+/**
+ * Booleans are packed into bits after the length prefix, which holds the number of bits.
+ */
+template< typename ... Args >
+struct SerialType< vector< bool, Args... >, std::true_type > {
+    using ValueType = vector< bool, Args... >;
+    using SizeType = typename rebind_size< ValueType >::SizeType;
+    using DataType = bool;
+
+    static_assert( std::is_integral< SizeType >::value && std::is_unsigned< SizeType >::value,
+        "length prefix must be an unsigned integer" );
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        hash_combine( value, serial_traits< ValueType >::internal_ident );
+        SerialType< SizeType >::hash( value, nesting );
+        SerialType< DataType >::hash( value, nesting );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return sizeof( SizeType );
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        return sizeof( SizeType ) + bits_traits::bytes( value.size() );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        begin.bout( SizeType( value.size() ) );
+
+        bits_traits::bout( value.size(), begin, [ & ]( std::size_t index ) {
+            uint64_t word = 0;
+            std::size_t first = index * bits_traits::word_bits;
+            std::size_t last = std::min( first + bits_traits::word_bits, value.size() );
+            for ( std::size_t bit = first; bit < last; ++bit )
+                word |= uint64_t( value[ bit ] ) << ( bit - first );
+            return word;
+        } );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        SizeType data_size;
+        begin.bin( data_size, end );
+
+        if ( size_overflow( begin, end, bits_traits::bytes( data_size ), sizeof( uint8_t ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        rebind_resource< ValueType >::apply( value );
+        value.resize( data_size );
+
+        bits_traits::bin( data_size, begin, end, [ & ]( std::size_t index, uint64_t word ) {
+            std::size_t first = index * bits_traits::word_bits;
+            std::size_t last = std::min( first + bits_traits::word_bits, value.size() );
+            for ( std::size_t bit = first; bit < last; ++bit )
+                value[ bit ] = ( ( word >> ( bit - first ) ) & 1 ) != 0;
+        } );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        SizeType data_size;
+        begin.bin( data_size, end );
+
+        if ( size_overflow( begin, end, bits_traits::bytes( data_size ), sizeof( uint8_t ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        begin.template skip< uint8_t >( bits_traits::bytes( data_size ), end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.bits( sizeof( SizeType ) );
+    }
+
+    /**
+     *
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data <<
+                "< " << SerialMetatype< DataType >::alias().data <<
+                " >[" << value.size() << "]: ";
+
+        if ( value.empty() ) {
+            stream << "empty";
+            return;
+        }
+
+        std::string separator = std::string( ", " );
+
+        for ( std::size_t index = 0; index < value.size(); ++index ) {
+            if ( index > 0 )
+                stream << separator.c_str();
+            SerialType< DataType >::debug( value[ index ], stream, level + 1 );
+        }
+    }
+};
+
 }} // --- namespace
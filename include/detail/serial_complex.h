@@ -60,18 +60,25 @@ struct SerialType< complex< Arg >, is_primitive< typename complex< Arg >::value_
     /**
      *
      */
-    static std::size_t size( const ValueType& value ) {
+    static constexpr bool fixed() {
 
-        return size();
+        return true;
     }
 
     /**
      *
      */
-    template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static constexpr bool trivial() {
+
+        return sizeof( ValueType ) == size();
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
 
-        begin += size();
+        return size();
     }
 
     /**
@@ -91,18 +98,35 @@ struct SerialType< complex< Arg >, is_primitive< typename complex< Arg >::value_
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
         DataType real_part;
-        begin.bin( real_part );
+        begin.bin( real_part, end );
 
         DataType imag_part;
-        begin.bin( imag_part );
+        begin.bin( imag_part, end );
 
         value.real( real_part );
         value.imag( imag_part );
     }
 
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        begin.template skip< DataType >( 2, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.bytes( size() );
+    }
+
     /**
      *
      */
@@ -0,0 +1,279 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Reads the length prefix of the given width.
+ */
+template< typename Iterator >
+static uint64_t bin_prefix( Iterator& begin, std::size_t prefix ) {
+
+    switch ( prefix ) {
+    case sizeof( uint8_t ): {
+        uint8_t data_size;
+        begin.bin( data_size );
+        return data_size;
+    }
+    case sizeof( uint16_t ): {
+        uint16_t data_size;
+        begin.bin( data_size );
+        return data_size;
+    }
+    case sizeof( uint32_t ): {
+        uint32_t data_size;
+        begin.bin( data_size );
+        return data_size;
+    }
+    default: {
+        uint64_t data_size;
+        begin.bin( data_size );
+        return data_size;
+    }
+    }
+}
+
+} // --- namespace
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+SerialDecoder< T, endian >::SerialDecoder() {
+
+    reset();
+}
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+std::size_t SerialDecoder< T, endian >::feed( const char* data, std::size_t size ) {
+
+    if ( done() )
+        return 0;
+
+    m_bytes.append( data, size );
+    advance();
+
+    if ( !done() )
+        return size;
+
+    std::size_t rest = m_bytes.size() - m_offset;
+    m_bytes.resize( m_offset );
+    return size - rest;
+}
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+std::size_t SerialDecoder< T, endian >::need() const {
+
+    return m_need;
+}
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+bool SerialDecoder< T, endian >::done() const {
+
+    return m_stack.empty();
+}
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+T SerialDecoder< T, endian >::get() {
+
+    T value;
+    get( value );
+    return value;
+}
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+void SerialDecoder< T, endian >::get( T& value ) {
+
+    if ( !done() )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    using detail::SerialType;
+
+    using SerialIteratorType = detail::SerialIteratorConstAlias< SerialWrapper< std::string, endian > >;
+    SerialIteratorType begin( m_bytes.cbegin() + sizeof( uint64_t ) );
+    SerialIteratorType end( m_bytes.cend() );
+
+    detail::SharedScope scope;
+    SerialType< T >::bin( value, begin, end );
+    reset();
+}
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+void SerialDecoder< T, endian >::reset() {
+
+    m_bytes.clear();
+    m_stack.assign( 1, Frame{ &detail::scan_program< T >(), 0, 1 } );
+    m_offset = 0;
+    m_need = sizeof( uint64_t );
+}
+
+/**
+ *
+ */
+template< typename T, SerialEndian endian >
+bool SerialDecoder< T, endian >::reserve( std::size_t size ) {
+
+    std::size_t available = m_bytes.size() - m_offset;
+    m_need = available < size ? size - available : 0;
+    return m_need == 0;
+}
+
+/**
+ * Resumes the scan from the saved position, so received bytes are never examined twice.
+ * The scan follows the program of the type, so the message must be of the type itself and not of a compatible one,
+ * otherwise the end of the message would be taken at the end of the compatible prefix.
+ */
+template< typename T, SerialEndian endian >
+void SerialDecoder< T, endian >::advance() {
+
+    using detail::ScanOp;
+    using SerialIteratorType = detail::SerialIteratorConstAlias< SerialWrapper< std::string, endian > >;
+
+    if ( m_offset == 0 ) {
+        if ( !reserve( sizeof( uint64_t ) ) )
+            return;
+
+        uint64_t hash;
+        SerialIteratorType begin( m_bytes.cbegin() );
+        begin.bin( hash );
+
+        detail::check_hash< T >( hash );
+
+        if ( hash != detail::serial_hash< T >() )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
+
+        m_offset += sizeof( uint64_t );
+    }
+
+    while ( !m_stack.empty() ) {
+        Frame& frame = m_stack.back();
+
+        if ( frame.index == frame.program->size() ) {
+            frame.index = 0;
+            if ( --frame.count == 0 )
+                m_stack.pop_back();
+            continue;
+        }
+
+        const ScanOp& op = ( *frame.program )[ frame.index ];
+
+        if ( op.code == ScanOp::Variant ) {
+            if ( !reserve( op.prefix ) )
+                return;
+
+            SerialIteratorType begin( m_bytes.cbegin() + m_offset );
+            uint64_t index = detail::bin_prefix( begin, op.prefix );
+
+            if ( index >= op.size )
+                throw SerialException( SerialException::ExcLayoutIncompatible );
+
+            const detail::ScanProgram* alternative = &( *frame.program )[ frame.index + 1 + std::size_t( index ) ].program();
+
+            m_offset += op.prefix;
+            frame.index += 1 + op.size;
+            m_stack.push_back( Frame{ alternative, 0, 1 } );
+            continue;
+        }
+
+        const detail::ScanProgram* program = op.program ? &op.program() : nullptr;
+
+        std::size_t prefix = 0;
+        std::size_t count = op.code == ScanOp::Bytes ? 1 : op.size;
+        std::size_t element = op.code == ScanOp::Bytes || op.code == ScanOp::Range || op.code == ScanOp::Bits ?
+                op.size : program->fixed();
+
+        if ( op.code == ScanOp::Range || op.code == ScanOp::Sequence || op.code == ScanOp::Index || op.code == ScanOp::Bits ||
+                op.code == ScanOp::Optional || op.code == ScanOp::Shared ) {
+            if ( !reserve( op.prefix ) )
+                return;
+
+            SerialIteratorType begin( m_bytes.cbegin() + m_offset );
+            uint64_t data_size = detail::bin_prefix( begin, op.prefix );
+
+            if ( op.code == ScanOp::Index && data_size > op.size ) {
+                uint64_t chunks = ( data_size - 1 ) / op.size + 1;
+                if ( chunks > ( std::numeric_limits< std::size_t >::max() - op.prefix ) / sizeof( uint64_t ) )
+                    throw SerialException( SerialException::ExcBufferOverflow );
+
+                std::size_t index_size = op.prefix + sizeof( uint64_t ) * std::size_t( chunks );
+                if ( !reserve( index_size ) )
+                    return;
+
+                uint64_t elements_size;
+                SerialIteratorType last( m_bytes.cbegin() + m_offset + index_size - sizeof( uint64_t ) );
+                last.bin( elements_size );
+
+                if ( elements_size > std::numeric_limits< std::size_t >::max() - index_size )
+                    throw SerialException( SerialException::ExcBufferOverflow );
+
+                if ( !reserve( index_size + std::size_t( elements_size ) ) )
+                    return;
+
+                m_offset += index_size + std::size_t( elements_size );
+                ++frame.index;
+                continue;
+            }
+
+            if ( op.code == ScanOp::Optional && data_size > 1 )
+                throw SerialException( SerialException::ExcLayoutIncompatible );
+
+            if ( element != 0 && data_size > ( std::numeric_limits< std::size_t >::max() - op.prefix ) / element )
+                throw SerialException( SerialException::ExcBufferOverflow );
+
+            prefix = op.prefix;
+            count = op.code == ScanOp::Bits ? detail::bits_traits::bytes( data_size ) : std::size_t( data_size );
+
+            if ( op.code == ScanOp::Shared )
+                count = data_size == 1 ? 1 : 0;
+        }
+
+        if ( element != 0 || count == 0 || program->empty() ) {
+            if ( !reserve( prefix + element * count ) )
+                return;
+
+            m_offset += prefix + element * count;
+            ++frame.index;
+            continue;
+        }
+
+        m_offset += prefix;
+        ++frame.index;
+        m_stack.push_back( Frame{ program, 0, count } );
+    }
+
+    m_need = 0;
+}
+
+} // --- namespace
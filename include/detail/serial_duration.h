@@ -63,18 +63,25 @@ struct SerialType< duration< Rep, Period >, std::true_type > {
     /**
      *
      */
-    static std::size_t size( const ValueType& value ) {
+    static constexpr bool fixed() {
 
-        return size();
+        return true;
     }
 
     /**
      *
      */
-    template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static constexpr bool trivial() {
+
+        return SerialType< DataType >::trivial() && sizeof( ValueType ) == size();
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
 
-        begin += size();
+        return size();
     }
 
     /**
@@ -90,13 +97,30 @@ struct SerialType< duration< Rep, Period >, std::true_type > {
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
         DataType data;
-        SerialType< DataType >::bin( data, begin );
+        SerialType< DataType >::bin( data, begin, end );
         value = ValueType( data );
     }
 
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        SerialType< DataType >::skip( begin, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.bytes( size() );
+    }
+
     /**
      *
      */
@@ -17,9 +17,18 @@
 namespace memserial {
 namespace detail {
 
-template< typename T >
+template< typename T, SerialEncoding encoding = FixedEncoding >
 static constexpr uint64_t serial_hash() {
-    return SerialHash{ SerialMetatype< T >::alias().hash(), SerialType< T >::hash() }.full();
+    return SerialHash{ SerialMetatype< T >::alias().hash(),
+        SerialType< T >::hash() ^ ( encoding == CompactEncoding ? SERIAL_COMPACT_SALT : 0 ) }.full();
+}
+
+/**
+ * Checks whether the type has fixed size and its message fits into a buffer of the given size.
+ */
+template< typename T, std::size_t N >
+static constexpr bool serial_fixed_fits() {
+    return SerialType< T >::fixed() && N >= SerialType< uint64_t >::size() + SerialType< T >::size();
 }
 
 template< typename T >
@@ -14,6 +14,18 @@
 
 #pragma once
 
+/**
+ *
+ */
+#if !defined( SERIAL_SIMD_UNDEFINED )
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+#define SERIAL_SIMD_X86
+#else
+#define SERIAL_SIMD_UNDEFINED
+#endif
+#endif
+
 namespace memserial {
 namespace detail {
 
@@ -147,4 +159,284 @@ static auto reverse_endian( T x ) -> typename std::enable_if< std::is_floating_p
     return union_cast.reversed;
 }
 
+/**
+ *
+ */
+template< std::size_t N >
+static void reverse_scalar( char* dst, const char* src, std::size_t size ) {
+    using uintN_t = typename reversible_traits< N >::ReversibleType;
+    for ( std::size_t i = 0; i < size; ++i ) {
+        uintN_t reversible;
+        std::memcpy( &reversible, src + i * N, N );
+        reversible = reversible_traits< N >::reverse( reversible );
+        std::memcpy( dst + i * N, &reversible, N );
+    }
+}
+
+#if defined( SERIAL_SIMD_X86 )
+
+/**
+ *
+ */
+template< std::size_t N >
+static const char* reverse_shuffle() {
+    struct ShuffleMask {
+        char data[ 32 ];
+        ShuffleMask() {
+            for ( std::size_t i = 0; i < sizeof( data ); ++i )
+                data[ i ] = char( i % 16 / N * N + N - 1 - i % N );
+        }
+    };
+    static const ShuffleMask mask;
+    return mask.data;
+}
+
+template< std::size_t N >
+__attribute__(( target( "ssse3" ) ))
+static void reverse_ssse3( char* dst, const char* src, std::size_t size ) {
+    const __m128i mask = _mm_loadu_si128( reinterpret_cast< const __m128i* >( reverse_shuffle< N >() ) );
+    std::size_t bytes = N * size;
+    std::size_t offset = 0;
+    for ( ; offset + 16 <= bytes; offset += 16 ) {
+        __m128i x = _mm_loadu_si128( reinterpret_cast< const __m128i* >( src + offset ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dst + offset ), _mm_shuffle_epi8( x, mask ) );
+    }
+    reverse_scalar< N >( dst + offset, src + offset, ( bytes - offset ) / N );
+}
+
+template< std::size_t N >
+__attribute__(( target( "avx2" ) ))
+static void reverse_avx2( char* dst, const char* src, std::size_t size ) {
+    const __m256i mask = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( reverse_shuffle< N >() ) );
+    std::size_t bytes = N * size;
+    std::size_t offset = 0;
+    for ( ; offset + 64 <= bytes; offset += 64 ) {
+        __m256i x0 = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( src + offset ) );
+        __m256i x1 = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( src + offset + 32 ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( dst + offset ), _mm256_shuffle_epi8( x0, mask ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( dst + offset + 32 ), _mm256_shuffle_epi8( x1, mask ) );
+    }
+    for ( ; offset + 32 <= bytes; offset += 32 ) {
+        __m256i x = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( src + offset ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( dst + offset ), _mm256_shuffle_epi8( x, mask ) );
+    }
+    reverse_scalar< N >( dst + offset, src + offset, ( bytes - offset ) / N );
+}
+
+#endif
+
+/**
+ *
+ */
+template< std::size_t N >
+struct reverse_kernel {
+    using KernelType = void ( * )( char*, const char*, std::size_t );
+
+    static KernelType dispatch() {
+#if defined( SERIAL_SIMD_X86 )
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports( "avx2" ) )
+            return &reverse_avx2< N >;
+        if ( __builtin_cpu_supports( "ssse3" ) )
+            return &reverse_ssse3< N >;
+#endif
+        return &reverse_scalar< N >;
+    }
+
+    static void reverse( char* dst, const char* src, std::size_t size ) {
+        if ( N * size < 16 )
+            return reverse_scalar< N >( dst, src, size );
+        static const KernelType kernel = dispatch();
+        kernel( dst, src, size );
+    }
+};
+
+template<>
+struct reverse_kernel< 1 > {
+    static void reverse( char* dst, const char* src, std::size_t size ) {
+        std::memmove( dst, src, size );
+    }
+};
+
+/**
+ *
+ */
+template< class T >
+static void reverse_endian( T* dst, const T* src, std::size_t size ) {
+    reverse_kernel< sizeof( T ) >::reverse( reinterpret_cast< char* >( dst ), reinterpret_cast< const char* >( src ), size );
+}
+
+template< class T >
+static void reverse_endian( T* value, std::size_t size ) {
+    reverse_endian( value, value, size );
+}
+
+/**
+ * Slicing-by-8 tables of the reflected CRC32C polynomial.
+ */
+static const uint32_t ( *crc32c_table() )[ 256 ] {
+    struct CrcTable {
+        uint32_t data[ 8 ][ 256 ];
+        CrcTable() {
+            for ( uint32_t i = 0; i < 256; ++i ) {
+                uint32_t crc = i;
+                for ( int bit = 0; bit < 8; ++bit )
+                    crc = crc & 1 ? ( crc >> 1 ) ^ 0x82f63b78 : crc >> 1;
+                data[ 0 ][ i ] = crc;
+            }
+            for ( std::size_t k = 1; k < 8; ++k )
+                for ( std::size_t i = 0; i < 256; ++i )
+                    data[ k ][ i ] = ( data[ k - 1 ][ i ] >> 8 ) ^ data[ 0 ][ data[ k - 1 ][ i ] & 0xff ];
+        }
+    };
+    static const CrcTable table;
+    return table.data;
+}
+
+static uint32_t crc32c_scalar( uint32_t crc, const char* data, std::size_t size ) {
+    const uint32_t ( *table )[ 256 ] = crc32c_table();
+    const uint8_t* bytes = reinterpret_cast< const uint8_t* >( data );
+    for ( ; size >= 8; bytes += 8, size -= 8 ) {
+        uint32_t low = crc ^ ( uint32_t( bytes[ 0 ] ) | uint32_t( bytes[ 1 ] ) << 8 |
+                uint32_t( bytes[ 2 ] ) << 16 | uint32_t( bytes[ 3 ] ) << 24 );
+        crc = table[ 7 ][ low & 0xff ] ^ table[ 6 ][ ( low >> 8 ) & 0xff ] ^
+                table[ 5 ][ ( low >> 16 ) & 0xff ] ^ table[ 4 ][ low >> 24 ] ^
+                table[ 3 ][ bytes[ 4 ] ] ^ table[ 2 ][ bytes[ 5 ] ] ^ table[ 1 ][ bytes[ 6 ] ] ^ table[ 0 ][ bytes[ 7 ] ];
+    }
+    for ( ; size > 0; ++bytes, --size )
+        crc = table[ 0 ][ ( crc ^ *bytes ) & 0xff ] ^ ( crc >> 8 );
+    return crc;
+}
+
+/**
+ * Tables of the operator appending a run of zero bytes to CRC32C, used to join CRC of adjacent blocks.
+ */
+template< std::size_t N >
+static const uint32_t ( *crc32c_zeros() )[ 256 ] {
+    struct ZerosTable {
+        uint32_t data[ 4 ][ 256 ];
+
+        static uint32_t times( const uint32_t* matrix, uint32_t vector ) {
+            uint32_t sum = 0;
+            for ( ; vector != 0; vector >>= 1, ++matrix )
+                if ( vector & 1 )
+                    sum ^= *matrix;
+            return sum;
+        }
+
+        static void square( uint32_t* result, const uint32_t* matrix ) {
+            for ( std::size_t n = 0; n < 32; ++n )
+                result[ n ] = times( matrix, matrix[ n ] );
+        }
+
+        ZerosTable() {
+            uint32_t even[ 32 ];
+            uint32_t odd[ 32 ];
+            odd[ 0 ] = 0x82f63b78;
+            for ( std::size_t n = 1; n < 32; ++n )
+                odd[ n ] = uint32_t( 1 ) << ( n - 1 );
+            square( even, odd );
+            square( odd, even );
+            const uint32_t* op = odd;
+            for ( std::size_t size = N; size != 0; ) {
+                square( even, odd );
+                op = even;
+                size >>= 1;
+                if ( size == 0 )
+                    break;
+                square( odd, even );
+                op = odd;
+                size >>= 1;
+            }
+            for ( uint32_t n = 0; n < 256; ++n )
+                for ( std::size_t k = 0; k < 4; ++k )
+                    data[ k ][ n ] = times( op, n << ( 8 * k ) );
+        }
+    };
+    static const ZerosTable table;
+    return table.data;
+}
+
+template< std::size_t N >
+static uint32_t crc32c_shift( uint32_t crc ) {
+    const uint32_t ( *zeros )[ 256 ] = crc32c_zeros< N >();
+    return zeros[ 0 ][ crc & 0xff ] ^ zeros[ 1 ][ ( crc >> 8 ) & 0xff ] ^
+            zeros[ 2 ][ ( crc >> 16 ) & 0xff ] ^ zeros[ 3 ][ crc >> 24 ];
+}
+
+#if defined( SERIAL_SIMD_X86 )
+
+/**
+ * Three independent streams hide latency of the crc32 instruction, their CRC are joined by the zeros operator.
+ */
+template< std::size_t N >
+__attribute__(( target( "sse4.2" ) ))
+static uint32_t crc32c_streams( uint32_t crc, const char*& data, std::size_t& size ) {
+#if defined( __x86_64__ )
+    for ( ; size >= 3 * N; data += 3 * N, size -= 3 * N ) {
+        uint64_t crc0 = crc;
+        uint64_t crc1 = 0;
+        uint64_t crc2 = 0;
+        for ( std::size_t offset = 0; offset < N; offset += 8 ) {
+            uint64_t word0, word1, word2;
+            std::memcpy( &word0, data + offset, sizeof( word0 ) );
+            std::memcpy( &word1, data + offset + N, sizeof( word1 ) );
+            std::memcpy( &word2, data + offset + 2 * N, sizeof( word2 ) );
+            crc0 = _mm_crc32_u64( crc0, word0 );
+            crc1 = _mm_crc32_u64( crc1, word1 );
+            crc2 = _mm_crc32_u64( crc2, word2 );
+        }
+        crc = crc32c_shift< N >( uint32_t( crc0 ) ) ^ uint32_t( crc1 );
+        crc = crc32c_shift< N >( crc ) ^ uint32_t( crc2 );
+    }
+#endif
+    return crc;
+}
+
+__attribute__(( target( "sse4.2" ) ))
+static uint32_t crc32c_sse42( uint32_t crc, const char* data, std::size_t size ) {
+    crc = crc32c_streams< 8192 >( crc, data, size );
+    crc = crc32c_streams< 256 >( crc, data, size );
+#if defined( __x86_64__ )
+    uint64_t crc64 = crc;
+    for ( ; size >= 8; data += 8, size -= 8 ) {
+        uint64_t word;
+        std::memcpy( &word, data, sizeof( word ) );
+        crc64 = _mm_crc32_u64( crc64, word );
+    }
+    crc = uint32_t( crc64 );
+#endif
+    for ( ; size >= 4; data += 4, size -= 4 ) {
+        uint32_t word;
+        std::memcpy( &word, data, sizeof( word ) );
+        crc = _mm_crc32_u32( crc, word );
+    }
+    for ( ; size > 0; ++data, --size )
+        crc = _mm_crc32_u8( crc, uint8_t( *data ) );
+    return crc;
+}
+
+#endif
+
+/**
+ *
+ */
+struct crc32c_kernel {
+    using KernelType = uint32_t ( * )( uint32_t, const char*, std::size_t );
+
+    static KernelType dispatch() {
+#if defined( SERIAL_SIMD_X86 )
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports( "sse4.2" ) )
+            return &crc32c_sse42;
+#endif
+        return &crc32c_scalar;
+    }
+
+    static uint32_t checksum( const char* data, std::size_t size ) {
+        static const KernelType kernel = dispatch();
+        return ~kernel( ~uint32_t( 0 ), data, size );
+    }
+};
+
 }} // --- namespace
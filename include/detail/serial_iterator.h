@@ -20,10 +20,12 @@ namespace detail {
 /**
  *
  */
-template< SerialEndian endian, typename Iterator >
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding = FixedEncoding >
 struct SerialIterator : Iterator {
     using iterator = Iterator;
     static constexpr SerialEndian order = endian;
+    static constexpr SerialEncoding coding = encoding;
+    static constexpr bool native = endian == NativeEndian && encoding == FixedEncoding;
 
     SerialIterator( const Iterator& iterator ) :
             Iterator( iterator ) {
@@ -37,17 +39,40 @@ struct SerialIterator : Iterator {
         return &( *this )[ 0 ];
     }
 
+    /**
+     * Least size of data used to bound nested data, compact data has no least size and is bounded on reading.
+     */
+    static constexpr std::size_t least( std::size_t size ) {
+        return encoding == CompactEncoding ? 0 : size;
+    }
+
+    /**
+     * Least size of array element used to check the number of elements before allocation.
+     */
+    static constexpr std::size_t width( std::size_t size ) {
+        return encoding == CompactEncoding && size != 0 ? 1 : size;
+    }
+
     template< typename ValueType >
     void bin( ValueType& value );
 
     template< typename ValueType >
     void bin( ValueType* value, std::size_t size );
 
+    template< typename ValueType >
+    void bin( ValueType& value, const SerialIterator& end );
+
+    template< typename ValueType >
+    void bin( ValueType* value, std::size_t size, const SerialIterator& end );
+
     template< typename ValueType >
     void bout( const ValueType& value );
 
     template< typename ValueType >
     void bout( const ValueType* value, std::size_t size );
+
+    template< typename ValueType >
+    void skip( std::size_t size, const SerialIterator& end );
 };
 
 /**
@@ -63,8 +88,7 @@ struct iterator_traits {
 
     template< typename ValueType, typename Iterator >
     static void bin( ValueType* value, std::size_t size, Iterator& begin ) {
-        for ( std::size_t i = 0; i < size; i++, begin += sizeof( value ) )
-            value[ i ] = reverse_endian( reinterpret_cast< const ValueType& >( *begin ) );
+        reverse_endian( value, reinterpret_cast< const ValueType* >( &begin ), size );
         begin += sizeof( ValueType ) * size;
     }
 
@@ -76,8 +100,7 @@ struct iterator_traits {
 
     template< typename ValueType, typename Iterator >
     static void bout( const ValueType* value, std::size_t size, Iterator& begin ) {
-        for ( std::size_t i = 0; i < size; i++, begin += sizeof( value ) )
-            reinterpret_cast< ValueType& >( *begin ) = reverse_endian( value[ i ] );
+        reverse_endian( reinterpret_cast< ValueType* >( &begin ), value, size );
         begin += sizeof( ValueType ) * size;
     }
 };
@@ -109,6 +132,89 @@ struct iterator_traits< NativeEndian > {
     }
 };
 
+/**
+ * Data in fixed encoding is bounded by least size of the type, so reading is not checked.
+ */
+template< SerialEncoding encoding, bool varint >
+struct coding_traits {
+    template< SerialEndian endian, typename ValueType, typename Iterator >
+    static void bin( ValueType* value, std::size_t size, Iterator& begin, const Iterator& end ) {
+        iterator_traits< endian >::bin( value, size, begin );
+    }
+
+    template< SerialEndian endian, typename ValueType, typename Iterator >
+    static void bout( const ValueType* value, std::size_t size, Iterator& begin ) {
+        iterator_traits< endian >::bout( value, size, begin );
+    }
+
+    template< typename ValueType, typename Iterator >
+    static void skip( std::size_t size, Iterator& begin, const Iterator& end ) {
+        begin += sizeof( ValueType ) * size;
+    }
+
+    template< typename ValueType >
+    static std::size_t size( const ValueType* value, std::size_t size ) {
+        return sizeof( ValueType ) * size;
+    }
+};
+
+template<>
+struct coding_traits< CompactEncoding, false > : coding_traits< FixedEncoding, false > {
+    template< SerialEndian endian, typename ValueType, typename Iterator >
+    static void bin( ValueType* value, std::size_t size, Iterator& begin, const Iterator& end ) {
+        if ( std::ptrdiff_t( sizeof( ValueType ) * size ) > std::distance( begin, end ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        iterator_traits< endian >::bin( value, size, begin );
+    }
+
+    template< typename ValueType, typename Iterator >
+    static void skip( std::size_t size, Iterator& begin, const Iterator& end ) {
+        if ( std::ptrdiff_t( sizeof( ValueType ) * size ) > std::distance( begin, end ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        begin += sizeof( ValueType ) * size;
+    }
+};
+
+template<>
+struct coding_traits< CompactEncoding, true > {
+    template< SerialEndian endian, typename ValueType, typename Iterator >
+    static void bin( ValueType* value, std::size_t size, Iterator& begin, const Iterator& end ) {
+        const char* data = &begin;
+        begin += varint_traits< ValueType >::get( value, size, data, data + std::distance( begin, end ) ) - data;
+    }
+
+    template< SerialEndian endian, typename ValueType, typename Iterator >
+    static void bout( const ValueType* value, std::size_t size, Iterator& begin ) {
+        char* data = &begin;
+        char* next = data;
+        for ( std::size_t index = 0; index < size; ++index )
+            next = varint_traits< ValueType >::put( next, value[ index ] );
+        begin += next - data;
+    }
+
+    template< typename ValueType, typename Iterator >
+    static void skip( std::size_t size, Iterator& begin, const Iterator& end ) {
+        const char* data = &begin;
+        const char* next = data;
+        const char* last = data + std::distance( begin, end );
+        for ( std::size_t index = 0; index < size; ++index ) {
+            do {
+                if ( next == last )
+                    throw SerialException( SerialException::ExcBufferOverflow );
+            } while ( uint8_t( *next++ ) & 0x80 );
+        }
+        begin += next - data;
+    }
+
+    template< typename ValueType >
+    static std::size_t size( const ValueType* value, std::size_t size ) {
+        std::size_t byte_size = 0;
+        for ( std::size_t index = 0; index < size; ++index )
+            byte_size += varint_traits< ValueType >::size( value[ index ] );
+        return byte_size;
+    }
+};
+
 /**
  *
  */
@@ -130,34 +236,129 @@ struct rebind_iterator< const char*, std::true_type > {
 /**
  *
  */
-template< SerialEndian endian, typename Iterator >
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
 template< typename ValueType >
-void SerialIterator< endian, Iterator >::bin( ValueType& value ) {
+void SerialIterator< endian, Iterator, encoding >::bin( ValueType& value ) {
     constexpr auto internal_endian = endian_traits< endian, sizeof( ValueType ) >::internal_endian;
     iterator_traits< internal_endian >::bin( value, *this );
 }
 
-template< SerialEndian endian, typename Iterator >
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
 template< typename ValueType >
-void SerialIterator< endian, Iterator >::bin( ValueType* value, std::size_t size ) {
+void SerialIterator< endian, Iterator, encoding >::bin( ValueType* value, std::size_t size ) {
     constexpr auto internal_endian = endian_traits< endian, sizeof( ValueType ) >::internal_endian;
     iterator_traits< internal_endian >::bin( value, size, *this );
 }
 
-template< SerialEndian endian, typename Iterator >
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
+template< typename ValueType >
+void SerialIterator< endian, Iterator, encoding >::bin( ValueType& value, const SerialIterator& end ) {
+    if ( encoding == FixedEncoding )
+        bin( value );
+    else
+        bin( &value, 1, end );
+}
+
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
 template< typename ValueType >
-void SerialIterator< endian, Iterator >::bout( const ValueType& value ) {
+void SerialIterator< endian, Iterator, encoding >::bin( ValueType* value, std::size_t size, const SerialIterator& end ) {
     constexpr auto internal_endian = endian_traits< endian, sizeof( ValueType ) >::internal_endian;
-    iterator_traits< internal_endian >::bout( value, *this );
+    using CodingTraits = coding_traits< encoding, varint_traits< ValueType >::value >;
+    CodingTraits::template bin< internal_endian >( value, size, *this, end );
 }
 
-template< SerialEndian endian, typename Iterator >
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
 template< typename ValueType >
-void SerialIterator< endian, Iterator >::bout( const ValueType* value, std::size_t size ) {
+void SerialIterator< endian, Iterator, encoding >::bout( const ValueType& value ) {
     constexpr auto internal_endian = endian_traits< endian, sizeof( ValueType ) >::internal_endian;
-    iterator_traits< internal_endian >::bout( value, size, *this );
+    if ( encoding == FixedEncoding )
+        iterator_traits< internal_endian >::bout( value, *this );
+    else
+        bout( &value, 1 );
+}
+
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
+template< typename ValueType >
+void SerialIterator< endian, Iterator, encoding >::bout( const ValueType* value, std::size_t size ) {
+    constexpr auto internal_endian = endian_traits< endian, sizeof( ValueType ) >::internal_endian;
+    using CodingTraits = coding_traits< encoding, varint_traits< ValueType >::value >;
+    CodingTraits::template bout< internal_endian >( value, size, *this );
+}
+
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
+template< typename ValueType >
+void SerialIterator< endian, Iterator, encoding >::skip( std::size_t size, const SerialIterator& end ) {
+    using CodingTraits = coding_traits< encoding, varint_traits< ValueType >::value >;
+    CodingTraits::template skip< ValueType >( size, *this, end );
+}
+
+/**
+ * Checks whether the number of array elements exceeds the remaining data, division prevents overflow of 64-bit lengths.
+ */
+template< typename Iterator >
+bool size_overflow( const Iterator& begin, const Iterator& end, uint64_t count, std::size_t size ) {
+    std::ptrdiff_t distance = std::distance( begin, end );
+    std::size_t least = Iterator::width( size );
+    return distance < 0 || ( least != 0 && count > uint64_t( distance ) / least );
 }
 
+/**
+ *
+ */
+template< SerialEndian endian >
+struct SinkIterator {
+    static constexpr SerialEndian order = endian;
+    static constexpr SerialEncoding coding = FixedEncoding;
+    static constexpr bool native = endian == NativeEndian;
+
+    SerialSink& sink;
+
+    template< typename ValueType >
+    void bout( const ValueType& value ) {
+        bout( &value, 1 );
+    }
+
+    template< typename ValueType >
+    void bout( const ValueType* value, std::size_t size ) {
+        constexpr auto internal_endian = endian_traits< endian, sizeof( ValueType ) >::internal_endian;
+        if ( internal_endian == NativeEndian ) {
+            sink.write( reinterpret_cast< const char* >( value ), sizeof( ValueType ) * size );
+            return;
+        }
+        while ( size > 0 ) {
+            char* data = sink.acquire( sizeof( ValueType ) );
+            std::size_t count = std::min( size, sink.available() / sizeof( ValueType ) );
+            reverse_kernel< sizeof( ValueType ) >::reverse( data, reinterpret_cast< const char* >( value ), count );
+            sink.advance( sizeof( ValueType ) * count );
+            value += count;
+            size -= count;
+        }
+    }
+};
+
+/**
+ * Counts the size of data without writing it.
+ */
+template< SerialEndian endian, SerialEncoding encoding >
+struct CountIterator {
+    static constexpr SerialEndian order = endian;
+    static constexpr SerialEncoding coding = encoding;
+    static constexpr bool native = endian == NativeEndian && encoding == FixedEncoding;
+
+    std::size_t count;
+
+    template< typename ValueType >
+    void bout( const ValueType& value ) {
+        bout( &value, 1 );
+    }
+
+    template< typename ValueType >
+    void bout( const ValueType* value, std::size_t size ) {
+        using CodingTraits = coding_traits< encoding, varint_traits< ValueType >::value >;
+        count += CodingTraits::size( value, size );
+    }
+};
+
 template< typename ByteArray >
 using SerialIteratorAlias = SerialIterator<
         rebind_endian< ByteArray >::internal_endian,
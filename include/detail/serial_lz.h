@@ -0,0 +1,245 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Block is a sequence of LZ77 commands in the manner of LZ4: a token with the number of literals in the high nibble
+ * and the match length less the minimum in the low nibble, extra length bytes for nibbles equal to 15, literals,
+ * 2-byte little-endian match offset and extra length bytes of the match. The last command has literals only.
+ */
+constexpr std::size_t lz_min_match = 4;
+constexpr std::size_t lz_max_offset = 65535;
+constexpr std::size_t lz_hash_log = 12;
+constexpr std::size_t lz_last_literals = 5;
+constexpr std::size_t lz_match_limit = 12;
+
+/**
+ * Size of compressed data in the worst case of incompressible input.
+ */
+constexpr std::size_t lz_bound( std::size_t size ) {
+
+    return size + size / 255 + 16;
+}
+
+/**
+ *
+ */
+inline uint32_t lz_sequence( const char* data ) {
+
+    uint32_t value;
+    std::memcpy( &value, data, sizeof( value ) );
+    return value;
+}
+
+/**
+ *
+ */
+inline char* lz_length( char* data, std::size_t length ) {
+
+    for ( ; length >= 255; length -= 255 )
+        *data++ = char( 255 );
+
+    *data++ = char( length );
+    return data;
+}
+
+inline const char* lz_length( const char* data, const char* end, std::size_t& length ) {
+
+    uint8_t byte;
+
+    do {
+        if ( data == end )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        byte = uint8_t( *data++ );
+        length += byte;
+    } while ( byte == 255 );
+
+    return data;
+}
+
+/**
+ * Compares eight bytes at a time, the differing word is finished byte by byte.
+ */
+inline const char* lz_match( const char* pos, const char* ref, const char* end ) {
+
+    while ( end - pos >= 8 ) {
+        uint64_t a, b;
+        std::memcpy( &a, pos, sizeof( a ) );
+        std::memcpy( &b, ref, sizeof( b ) );
+        if ( a != b )
+            break;
+        pos += 8;
+        ref += 8;
+    }
+
+    while ( pos < end && *pos == *ref ) {
+        ++pos;
+        ++ref;
+    }
+
+    return pos;
+}
+
+/**
+ * Hash table is sized by the input, so small messages do not pay for clearing the whole table.
+ * Search step grows with the distance from the last match to pass incompressible data quickly.
+ */
+inline std::size_t lz_compress( const char* data, std::size_t size, char* dest ) {
+
+    const char* anchor = data;
+    const char* end = data + size;
+    char* out = dest;
+
+    if ( size > lz_match_limit ) {
+        std::size_t bits = 8;
+        while ( bits < lz_hash_log && ( std::size_t( 1 ) << bits ) < size )
+            ++bits;
+
+        uint32_t table[ 1 << lz_hash_log ];
+        std::fill_n( table, std::size_t( 1 ) << bits, 0 );
+
+        const char* limit = end - lz_match_limit;
+        const char* match_end = end - lz_last_literals;
+
+        for ( const char* pos = data; pos < limit; ) {
+            uint32_t sequence = lz_sequence( pos );
+            std::size_t slot = ( sequence * 2654435761u ) >> ( 32 - bits );
+            const char* ref = data + table[ slot ];
+            table[ slot ] = uint32_t( pos - data );
+
+            if ( ref >= pos || std::size_t( pos - ref ) > lz_max_offset || lz_sequence( ref ) != sequence ) {
+                pos += 1 + ( std::size_t( pos - anchor ) >> 6 );
+                continue;
+            }
+
+            const char* match = lz_match( pos + lz_min_match, ref + lz_min_match, match_end );
+
+            while ( pos > anchor && ref > data && pos[ -1 ] == ref[ -1 ] ) {
+                --pos;
+                --ref;
+            }
+
+            std::size_t literals = pos - anchor;
+            std::size_t length = match - pos - lz_min_match;
+            std::size_t offset = pos - ref;
+
+            *out++ = char( ( std::min< std::size_t >( literals, 15 ) << 4 ) | std::min< std::size_t >( length, 15 ) );
+            if ( literals >= 15 )
+                out = lz_length( out, literals - 15 );
+            std::memcpy( out, anchor, literals );
+            out += literals;
+
+            *out++ = char( offset & 0xff );
+            *out++ = char( offset >> 8 );
+            if ( length >= 15 )
+                out = lz_length( out, length - 15 );
+
+            pos = anchor = match;
+        }
+    }
+
+    std::size_t literals = end - anchor;
+    *out++ = char( std::min< std::size_t >( literals, 15 ) << 4 );
+    if ( literals >= 15 )
+        out = lz_length( out, literals - 15 );
+    std::memcpy( out, anchor, literals );
+    out += literals;
+
+    return out - dest;
+}
+
+/**
+ * Decompressed data must fill the destination exactly, every length and offset is checked against both buffers.
+ * Literals and matches are copied by whole words while both buffers have room for it,
+ * overlapping matches are copied in chunks doubling with the distance from the source.
+ */
+inline void lz_decompress( const char* data, std::size_t size, char* dest, std::size_t dest_size ) {
+
+    const char* end = data + size;
+    char* out = dest;
+    char* out_end = dest + dest_size;
+
+    for ( ;; ) {
+        if ( data == end )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        uint8_t token = uint8_t( *data++ );
+        std::size_t literals = token >> 4;
+        if ( literals == 15 )
+            data = lz_length( data, end, literals );
+
+        if ( literals > std::size_t( end - data ) || literals > std::size_t( out_end - out ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        if ( literals <= 16 && end - data >= 16 && out_end - out >= 16 )
+            std::memcpy( out, data, 16 );
+        else
+            std::memcpy( out, data, literals );
+        out += literals;
+        data += literals;
+
+        if ( data == end )
+            break;
+
+        if ( end - data < 2 )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        std::size_t offset = uint8_t( data[ 0 ] ) | std::size_t( uint8_t( data[ 1 ] ) ) << 8;
+        data += 2;
+
+        if ( offset == 0 || offset > std::size_t( out - dest ) )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
+
+        std::size_t length = token & 15;
+        if ( length == 15 )
+            data = lz_length( data, end, length );
+        length += lz_min_match;
+
+        if ( length > std::size_t( out_end - out ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        const char* ref = out - offset;
+        if ( offset >= 8 && std::size_t( out_end - out ) >= length + 8 ) {
+            for ( std::size_t index = 0; index < length; index += 8 )
+                std::memcpy( out + index, ref + index, 8 );
+            out += length;
+            continue;
+        }
+
+        while ( length > 0 ) {
+            std::size_t chunk = std::min( std::size_t( out - ref ), length );
+            std::memcpy( out, ref, chunk );
+            out += chunk;
+            length -= chunk;
+        }
+    }
+
+    if ( out != out_end )
+        throw SerialException( SerialException::ExcLayoutIncompatible );
+}
+
+/**
+ * Decompressed messages are kept until the next decompression on the same thread.
+ */
+inline std::string& lz_scratch() {
+
+    static thread_local std::string scratch;
+    return scratch;
+}
+
+}} // --- namespace
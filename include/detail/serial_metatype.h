@@ -147,9 +147,9 @@ struct SerialMetatype {
     static constexpr bool serial() { return false; }
     static constexpr SerialAlias alias() { return "undefined"; }
 
-    template< SerialEndian endian, typename Iterator >
+    template< SerialEndian endian, SerialEncoding encoding = FixedEncoding, typename Iterator >
     static constexpr auto iterator( const Iterator& i ) {
-        return SerialIterator< endian, Iterator >( i );
+        return SerialIterator< endian, Iterator, encoding >( i );
     }
 };
 
@@ -158,9 +158,9 @@ struct SerialMetatype< nulltype > {
     static constexpr bool serial() { return true; }
     static constexpr SerialAlias alias() { return "nulltype"; }
 
-    template< SerialEndian endian, typename Iterator >
+    template< SerialEndian endian, SerialEncoding encoding = FixedEncoding, typename Iterator >
     static constexpr auto iterator( const Iterator& i ) {
-        return SerialIterator< endian, Iterator >( i );
+        return SerialIterator< endian, Iterator, encoding >( i );
     }
 };
 
@@ -307,9 +307,9 @@ struct SerialMetatype< Type > { \
     static constexpr bool serial() { return true; } \
     static constexpr SerialAlias alias() { return UNPACK( Type ); } \
     \
-    template< SerialEndian endian, typename Iterator > \
+    template< SerialEndian endian, SerialEncoding encoding = FixedEncoding, typename Iterator > \
     static constexpr auto iterator( const Iterator& i ) { \
-        return SerialIterator< endian, Iterator >( i ); \
+        return SerialIterator< endian, Iterator, encoding >( i ); \
     } \
 }; \
 }}
@@ -399,4 +399,16 @@ SERIAL_METATYPE_ARG2( time_point, typename, typename )
 SERIAL_METATYPE_ARG2( duration, typename, typename )
 SERIAL_METATYPE_ARG2( ratio, std::intmax_t, std::intmax_t )
 SERIAL_METATYPE_ARG1( complex, typename )
+SERIAL_METATYPE_ARG2( pair, typename, typename )
+SERIAL_METATYPE_ARGS( map )
+SERIAL_METATYPE_ARGS( set )
+SERIAL_METATYPE_ARGS( unordered_map )
+SERIAL_METATYPE_ARGS( unordered_set )
+SERIAL_METATYPE_ARG1( shared_ptr, typename )
+SERIAL_METATYPE_ARG1( unique_ptr, typename )
+#if __cplusplus >= 201703L
+SERIAL_METATYPE_ARG1( optional, typename )
+SERIAL_METATYPE_ARGS( variant )
+SERIAL_METATYPE_ARG0( monostate )
+#endif
 }}
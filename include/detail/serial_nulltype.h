@@ -52,6 +52,22 @@ struct SerialType< nulltype, std::true_type > {
         return 0;
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return true;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
     /**
      *
      */
@@ -64,7 +80,7 @@ struct SerialType< nulltype, std::true_type > {
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
 
     }
 
@@ -72,7 +88,7 @@ struct SerialType< nulltype, std::true_type > {
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
     }
 
@@ -80,7 +96,14 @@ struct SerialType< nulltype, std::true_type > {
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
+
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
 
     }
 
@@ -0,0 +1,170 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if __cplusplus >= 201703L
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Presence flag is followed by the value only if it is set, so absent values take a single byte.
+ */
+template< typename Arg >
+struct SerialType< optional< Arg >, std::true_type > {
+    using ValueType = optional< Arg >;
+    using DataType = Arg;
+    using FlagType = uint8_t;
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        hash_combine( value, serial_traits< ValueType >::internal_ident );
+        SerialType< DataType >::hash( value, nesting );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return sizeof( FlagType );
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        return sizeof( FlagType ) + ( value ? SerialType< DataType >::size( *value ) : 0 );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        FlagType flag = value ? 1 : 0;
+        begin.bout( flag );
+
+        if ( value )
+            SerialType< DataType >::bout( *value, begin );
+    }
+
+    /**
+     * Present value is read in place of the held one, so its storage is reused.
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        if ( !bin_flag( begin, end ) ) {
+            value.reset();
+            return;
+        }
+
+        if ( !value )
+            value.emplace();
+
+        SerialType< DataType >::bin( *value, begin, end );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        if ( bin_flag( begin, end ) )
+            SerialType< DataType >::skip( begin, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.optional< DataType >();
+    }
+
+    /**
+     *
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data << ": ";
+
+        if ( value )
+            SerialType< DataType >::debug( *value, stream, level );
+        else
+            stream << "none";
+    }
+
+    /**
+     * Reads the presence flag and checks that the least size of the value follows it.
+     */
+    template< typename Iterator >
+    static bool bin_flag( Iterator& begin, Iterator& end ) {
+
+        FlagType flag;
+        begin.bin( flag, end );
+
+        if ( flag > 1 )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
+
+        if ( flag != 0 && size_overflow( begin, end, 1, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        return flag != 0;
+    }
+};
+
+}} // --- namespace
+
+#endif
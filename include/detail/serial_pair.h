@@ -0,0 +1,148 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Pair is written as tuple of two fields.
+ */
+template< typename First, typename Second >
+struct SerialType< pair< First, Second >, std::true_type > {
+    using ValueType = pair< First, Second >;
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        SerialType< First >::hash( value, nesting );
+        SerialType< Second >::hash( value, nesting );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return SerialType< First >::size() + SerialType< Second >::size();
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return SerialType< First >::fixed() && SerialType< Second >::fixed();
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        if ( fixed() )
+            return size();
+
+        return SerialType< First >::size( value.first ) + SerialType< Second >::size( value.second );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        SerialType< First >::bout( value.first, begin );
+        SerialType< Second >::bout( value.second, begin );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        Iterator least_end = end - Iterator::least( size() );
+
+        least_end += Iterator::least( SerialType< First >::size() );
+        SerialType< First >::bin( value.first, begin, least_end );
+
+        least_end += Iterator::least( SerialType< Second >::size() );
+        SerialType< Second >::bin( value.second, begin, least_end );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        Iterator least_end = end - Iterator::least( size() );
+
+        least_end += Iterator::least( SerialType< First >::size() );
+        SerialType< First >::skip( begin, least_end );
+
+        least_end += Iterator::least( SerialType< Second >::size() );
+        SerialType< Second >::skip( begin, least_end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        SerialType< First >::scan( program );
+        SerialType< Second >::scan( program );
+    }
+
+    /**
+     *
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data << ": ";
+        SerialType< First >::debug( value.first, stream, level + 1 );
+        stream << ", ";
+        SerialType< Second >::debug( value.second, stream, level + 1 );
+    }
+};
+
+}} // --- namespace
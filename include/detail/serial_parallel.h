@@ -0,0 +1,262 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Executor of the current serialize or parse call, null if arrays are processed sequentially.
+ */
+inline SerialExecutor*& serial_executor() {
+
+    static thread_local SerialExecutor* executor = nullptr;
+    return executor;
+}
+
+/**
+ *
+ */
+struct ExecutorScope {
+    SerialExecutor* previous;
+
+    explicit ExecutorScope( SerialExecutor* executor ) :
+            previous( serial_executor() ) {
+        serial_executor() = executor;
+    }
+
+    ~ExecutorScope() {
+        serial_executor() = previous;
+    }
+};
+
+/**
+ * Sizes of slices of arrays recorded while sizing the value, so writing the value does not size the arrays again.
+ */
+struct SliceTable {
+    std::unordered_map< const void*, std::vector< uint64_t > > sizes;
+};
+
+/**
+ * Table of the current serialize call, null if sizes are not recorded.
+ */
+inline SliceTable*& serial_slices() {
+
+    static thread_local SliceTable* table = nullptr;
+    return table;
+}
+
+/**
+ *
+ */
+struct SliceScope {
+    SliceTable* previous;
+
+    explicit SliceScope( SliceTable* table ) :
+            previous( serial_slices() ) {
+        serial_slices() = table;
+    }
+
+    ~SliceScope() {
+        serial_slices() = previous;
+    }
+};
+
+/**
+ *
+ */
+inline void record_slices( const void* data, const std::vector< uint64_t >& sizes ) {
+
+    if ( SliceTable* table = serial_slices() )
+        table->sizes[ data ] = sizes;
+}
+
+/**
+ * Returns sizes recorded for the array split into the given number of slices, null if there are none.
+ */
+inline const std::vector< uint64_t >* recorded_slices( const void* data, std::size_t slices ) {
+
+    SliceTable* table = serial_slices();
+    if ( !table )
+        return nullptr;
+
+    auto found = table->sizes.find( data );
+    return found != table->sizes.end() && found->second.size() == slices ? &found->second : nullptr;
+}
+
+/**
+ * Only iterators over contiguous data and counting iterators can be split into slices.
+ */
+template< typename Iterator >
+struct parallel_traits : std::false_type {
+    static constexpr bool counting = false;
+
+    static void advance( Iterator& begin, std::size_t size ) {}
+};
+
+template< SerialEndian endian, typename Iterator, SerialEncoding encoding >
+struct parallel_traits< SerialIterator< endian, Iterator, encoding > > : std::true_type {
+    static constexpr bool counting = false;
+
+    static void advance( SerialIterator< endian, Iterator, encoding >& begin, std::size_t size ) {
+        begin += size;
+    }
+};
+
+template< SerialEndian endian, SerialEncoding encoding >
+struct parallel_traits< CountIterator< endian, encoding > > : std::true_type {
+    static constexpr bool counting = true;
+
+    static void advance( CountIterator< endian, encoding >& begin, std::size_t size ) {
+        begin.count += size;
+    }
+};
+
+/**
+ * Returns the number of slices of the array, zero if the array is written sequentially.
+ */
+inline std::size_t parallel_slices( std::size_t size, bool enabled = true ) {
+
+    SerialExecutor* executor = serial_executor();
+    if ( !enabled || !executor || size < SERIAL_PARALLEL_THRESHOLD || executor->concurrency() < 2 )
+        return 0;
+
+    return std::min( executor->concurrency() * 4, size * 4 / SERIAL_PARALLEL_THRESHOLD );
+}
+
+/**
+ * Tasks run without executor, so nested arrays are written sequentially and a bounded pool is never waited from
+ * its own thread, nor do they record sizes, the first exception of the tasks is rethrown.
+ */
+inline void parallel_run( std::size_t slices, const SerialExecutor::TaskType& task ) {
+
+    std::vector< std::exception_ptr > errors( slices );
+
+    serial_executor()->run( slices, [ & ]( std::size_t slice ) {
+        ExecutorScope scope( nullptr );
+        SliceScope slice_scope( nullptr );
+        try {
+            task( slice );
+        }
+        catch ( ... ) {
+            errors[ slice ] = std::current_exception();
+        }
+    } );
+
+    for ( const auto& error : errors )
+        if ( error )
+            std::rethrow_exception( error );
+}
+
+/**
+ * Decoding in parallel is disabled with a memory resource, which is not required to be thread safe.
+ */
+inline bool parallel_decode() {
+
+#if defined( SERIAL_MEMORY_RESOURCE )
+    return serial_resource() == nullptr;
+#else
+    return true;
+#endif
+}
+
+/**
+ * Splits the range of chunks into slices run in parallel if an executor is set, otherwise runs the whole range.
+ */
+inline void parallel_for( std::size_t count, bool enabled, const std::function< void( std::size_t, std::size_t ) >& task ) {
+
+    SerialExecutor* executor = serial_executor();
+    if ( !enabled || !executor || count < 2 || executor->concurrency() < 2 ) {
+        task( 0, count );
+        return;
+    }
+
+    std::size_t slices = std::min( executor->concurrency() * 4, count );
+    parallel_run( slices, [ & ]( std::size_t slice ) {
+        task( count * slice / slices, count * ( slice + 1 ) / slices );
+    } );
+}
+
+/**
+ *
+ */
+template< typename DataType >
+std::size_t parallel_size( const DataType* data, std::size_t size, std::size_t slices ) {
+
+    std::vector< uint64_t > sizes( slices );
+
+    parallel_run( slices, [ & ]( std::size_t slice ) {
+        std::size_t byte_size = 0;
+        for ( std::size_t index = size * slice / slices; index < size * ( slice + 1 ) / slices; ++index )
+            byte_size += SerialType< DataType >::size( data[ index ] );
+        sizes[ slice ] = byte_size;
+    } );
+
+    record_slices( data, sizes );
+
+    std::size_t byte_size = 0;
+    for ( uint64_t slice_size : sizes )
+        byte_size += std::size_t( slice_size );
+
+    return byte_size;
+}
+
+/**
+ * Slices are sized in parallel unless their sizes were recorded while sizing the value, their offsets are
+ * the prefix sum of sizes, then every slice is written in place, so the output is identical to sequential writing.
+ */
+template< typename DataType, typename Iterator >
+void parallel_bout( const DataType* data, std::size_t size, std::size_t slices, Iterator& begin ) {
+
+    std::vector< uint64_t > offsets( slices + 1 );
+
+    if ( const std::vector< uint64_t >* sizes = recorded_slices( data, slices ) ) {
+        std::copy( sizes->begin(), sizes->end(), offsets.begin() + 1 );
+    }
+    else {
+        parallel_run( slices, [ & ]( std::size_t slice ) {
+            CountIterator< Iterator::order, Iterator::coding > counter{ 0 };
+            for ( std::size_t index = size * slice / slices; index < size * ( slice + 1 ) / slices; ++index ) {
+                if ( Iterator::coding == FixedEncoding )
+                    counter.count += SerialType< DataType >::size( data[ index ] );
+                else
+                    SerialType< DataType >::bout( data[ index ], counter );
+            }
+            offsets[ slice + 1 ] = counter.count;
+        } );
+
+        if ( parallel_traits< Iterator >::counting )
+            record_slices( data, std::vector< uint64_t >( offsets.begin() + 1, offsets.end() ) );
+    }
+
+    for ( std::size_t slice = 0; slice < slices; ++slice )
+        offsets[ slice + 1 ] += offsets[ slice ];
+
+    if ( parallel_traits< Iterator >::counting ) {
+        parallel_traits< Iterator >::advance( begin, offsets[ slices ] );
+        return;
+    }
+
+    parallel_run( slices, [ & ]( std::size_t slice ) {
+        Iterator slice_begin = begin;
+        parallel_traits< Iterator >::advance( slice_begin, offsets[ slice ] );
+        for ( std::size_t index = size * slice / slices; index < size * ( slice + 1 ) / slices; ++index )
+            SerialType< DataType >::bout( data[ index ], slice_begin );
+    } );
+
+    parallel_traits< Iterator >::advance( begin, offsets[ slices ] );
+}
+
+}} // --- namespace
@@ -0,0 +1,372 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Reference is zero for null, one for a new object written after it,
+ * otherwise it is the number of a preceding object plus two, so every object is written once.
+ */
+template< typename Arg >
+struct SerialType< shared_ptr< Arg >, std::true_type > {
+    using ValueType = shared_ptr< Arg >;
+    using DataType = std::remove_const_t< Arg >;
+    using ReferenceType = uint32_t;
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        hash_combine( value, serial_traits< ValueType >::internal_ident );
+        SerialType< DataType >::hash( value, nesting );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return sizeof( ReferenceType );
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        if ( reference( value ) != 1 )
+            return sizeof( ReferenceType );
+
+        return sizeof( ReferenceType ) + SerialType< DataType >::size( *value );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        ReferenceType data_reference = reference( value );
+        begin.bout( data_reference );
+
+        if ( data_reference == 1 )
+            SerialType< DataType >::bout( *value, begin );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        ReferenceType data_reference;
+        begin.bin( data_reference, end );
+
+        if ( data_reference == 0 ) {
+            value.reset();
+            return;
+        }
+
+        if ( data_reference == 1 ) {
+            value = bin_object( begin, end );
+            return;
+        }
+
+        SharedTable* table = serial_shared();
+        std::size_t number = data_reference - 2;
+
+        if ( !table || number >= table->read.size() || table->read[ number ].tag != shared_tag< DataType >() )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
+
+        value = std::static_pointer_cast< DataType >( table->read[ number ].object );
+    }
+
+    /**
+     * New object is decoded if the objects are numbered, since the following data may refer to it.
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        ReferenceType data_reference;
+        begin.bin( data_reference, end );
+
+        if ( data_reference != 1 )
+            return;
+
+        if ( serial_shared() ) {
+            bin_object( begin, end );
+            return;
+        }
+
+        if ( size_overflow( begin, end, 1, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        SerialType< DataType >::skip( begin, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.shared< DataType >( sizeof( ReferenceType ) );
+    }
+
+    /**
+     * Objects are printed up to the nesting limit, since they may refer to themselves.
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data << ": ";
+
+        if ( !value )
+            stream << "null";
+        else if ( level >= SERIAL_NESTING_LIMIT )
+            stream << "...";
+        else
+            SerialType< DataType >::debug( *value, stream, level + 1 );
+    }
+
+    /**
+     * Numbers the object on its first occurrence, objects are written inline without the table of the call.
+     */
+    static ReferenceType reference( const ValueType& value ) {
+
+        if ( !value )
+            return 0;
+
+        SharedTable* table = serial_shared();
+        if ( !table )
+            return 1;
+
+        auto found = table->written.find( value.get() );
+        if ( found != table->written.end() && found->second.tag == shared_tag< DataType >() )
+            return ReferenceType( found->second.number + 2 );
+
+        if ( table->count > std::size_t( std::numeric_limits< ReferenceType >::max() - 2 ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        if ( found == table->written.end() )
+            table->written.emplace( value.get(), SharedTable::WrittenEntry{ uint32_t( table->count ), shared_tag< DataType >() } );
+
+        ++table->count;
+        return 1;
+    }
+
+    /**
+     * Object is numbered before its data is decoded, so the data may refer to the object itself.
+     */
+    template< typename Iterator >
+    static std::shared_ptr< DataType > bin_object( Iterator& begin, Iterator& end ) {
+
+        if ( size_overflow( begin, end, 1, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        auto object = std::make_shared< DataType >();
+
+        if ( SharedTable* table = serial_shared() )
+            table->read.push_back( SharedTable::ReadEntry{ object, shared_tag< DataType >() } );
+
+        SerialType< DataType >::bin( *object, begin, end );
+        return object;
+    }
+};
+
+/**
+ * Presence flag is followed by the object only if it is set, the object is owned by a single pointer and never shared.
+ */
+template< typename Arg >
+struct SerialType< unique_ptr< Arg >, std::true_type > {
+    using ValueType = unique_ptr< Arg >;
+    using DataType = std::remove_const_t< Arg >;
+    using FlagType = uint8_t;
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        hash_combine( value, serial_traits< ValueType >::internal_ident );
+        SerialType< DataType >::hash( value, nesting );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return sizeof( FlagType );
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        return sizeof( FlagType ) + ( value ? SerialType< DataType >::size( *value ) : 0 );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        FlagType flag = value ? 1 : 0;
+        begin.bout( flag );
+
+        if ( value )
+            SerialType< DataType >::bout( *value, begin );
+    }
+
+    /**
+     * Held object of mutable type is read in place, so its storage is reused.
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        if ( !bin_flag( begin, end ) ) {
+            value.reset();
+            return;
+        }
+
+        if ( value && !std::is_const< Arg >::value ) {
+            SerialType< DataType >::bin( const_cast< DataType& >( *value ), begin, end );
+            return;
+        }
+
+        std::unique_ptr< DataType > object( new DataType() );
+        SerialType< DataType >::bin( *object, begin, end );
+        value = std::move( object );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        if ( bin_flag( begin, end ) )
+            SerialType< DataType >::skip( begin, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.optional< DataType >();
+    }
+
+    /**
+     *
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data << ": ";
+
+        if ( value )
+            SerialType< DataType >::debug( *value, stream, level + 1 );
+        else
+            stream << "null";
+    }
+
+    /**
+     * Reads the presence flag and checks that the least size of the object follows it.
+     */
+    template< typename Iterator >
+    static bool bin_flag( Iterator& begin, Iterator& end ) {
+
+        FlagType flag;
+        begin.bin( flag, end );
+
+        if ( flag > 1 )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
+
+        if ( flag != 0 && size_overflow( begin, end, 1, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        return flag != 0;
+    }
+};
+
+}} // --- namespace
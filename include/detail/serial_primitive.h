@@ -56,6 +56,22 @@ struct SerialType< T, is_primitive< T > > {
         return sizeof( ValueType );
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return true;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return true;
+    }
+
     /**
      *
      */
@@ -68,27 +84,35 @@ struct SerialType< T, is_primitive< T > > {
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
 
-        begin += size();
+        begin.bout( value );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
-        begin.bout( value );
+        begin.bin( value, end );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        begin.template skip< ValueType >( 1, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
 
-        begin.bin( value );
+        program.bytes( size() );
     }
 
     /**
@@ -0,0 +1,228 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Reads the data section of the type, the header is already read, returns false if the least size does not fit.
+ */
+template< typename T, SerialEncoding encoding, typename Iterator >
+static bool bin_entry( T& value, Iterator& begin, uint64_t size ) {
+
+    using IteratorType = typename Iterator::iterator;
+    constexpr auto serial_order = Iterator::order;
+
+    if ( SerialIterator< serial_order, IteratorType, encoding >::least( SerialType< T >::size() ) > size )
+        return false;
+
+    auto serial_begin = SerialMetatype< T >::template iterator< serial_order, encoding >( IteratorType( begin ) );
+    auto serial_end = SerialMetatype< T >::template iterator< serial_order, encoding >( IteratorType( begin + size ) );
+
+    SharedScope scope;
+    SerialType< T >::bin( value, serial_begin, serial_end );
+    return true;
+}
+
+/**
+ * Type-erased entry points of a registered type, parse and trace read messages held by std::string
+ * in native byte order and fixed encoding, the value passed to parse must be of the registered type.
+ */
+struct SerialEntry {
+    std::size_t index;
+    uint64_t hash;
+    std::string alias;
+    bool ( *match )( uint32_t );
+    std::size_t ( *size )();
+    void ( *parse )( const std::string&, void* );
+    void ( *trace )( const std::string&, std::ostream& );
+};
+
+/**
+ *
+ */
+struct SerialRegistry {
+    std::vector< SerialEntry > entries;
+    std::unordered_map< uint64_t, std::size_t > hashes;
+    std::unordered_map< std::string, std::size_t > aliases;
+    std::unordered_map< uint32_t, std::size_t > layouts;
+
+    const SerialEntry* find( uint64_t hash ) const {
+        auto it = hashes.find( hash );
+        return it != hashes.end() ? &entries[ it->second ] : nullptr;
+    }
+
+    const SerialEntry* find( const std::string& alias ) const {
+        auto it = aliases.find( alias );
+        return it != aliases.end() ? &entries[ it->second ] : nullptr;
+    }
+
+    const SerialEntry* layout( uint32_t hash ) const {
+        auto it = layouts.find( hash );
+        return it != layouts.end() ? &entries[ it->second ] : nullptr;
+    }
+};
+
+/**
+ *
+ */
+struct RegistryFunctor {
+    SerialRegistry& registry;
+
+    template< std::size_t Index >
+    void operator()( size_t_< Index > ) {
+        using ValueType = typename SerialIdentity< Index >::ValueType;
+        registry.entries[ Index ] = SerialEntry{ Index, serial_hash< ValueType >(), serial_alias< ValueType >(),
+            &SerialType< ValueType >::match, &size_entry< ValueType >, &parse_entry< ValueType >, &trace_entry< ValueType > };
+    }
+
+    template< typename ValueType >
+    static std::size_t size_entry() {
+        return SerialType< ValueType >::size();
+    }
+
+    template< typename ValueType >
+    static void parse_entry( const std::string& bytes, void* value ) {
+        using IteratorType = SerialIteratorConstAlias< std::string >;
+        if ( SerialType< uint64_t >::size() > bytes.size() )
+            throw SerialException( SerialException::ExcBufferOverflow );
+        IteratorType begin( bytes.begin() );
+        IteratorType end( bytes.end() );
+        uint64_t hash;
+        SerialType< uint64_t >::bin( hash, begin, end );
+        if ( hash != serial_hash< ValueType >() )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
+        if ( !bin_entry< ValueType, FixedEncoding >( *static_cast< ValueType* >( value ), begin, bytes.size() - SerialType< uint64_t >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+    }
+
+    template< typename ValueType >
+    static void trace_entry( const std::string& bytes, std::ostream& stream ) {
+        ValueType value{};
+        parse_entry< ValueType >( bytes, &value );
+        SerialType< ValueType >::debug( value, stream, 0 );
+    }
+};
+
+/**
+ * Registered types with the same hash could not be told apart, so the registry is not built.
+ * \throw SerialException In case of hash collision between registered types.
+ */
+inline SerialRegistry make_registry() {
+
+    SerialRegistry registry;
+    registry.entries.resize( count_serial() );
+
+    RegistryFunctor functor{ registry };
+    foreach_serial( functor );
+
+    for ( const auto& entry : registry.entries ) {
+        auto result = registry.hashes.emplace( entry.hash, entry.index );
+        if ( !result.second )
+            throw SerialException( SerialException::ExcHashCollision );
+        registry.aliases.emplace( entry.alias, entry.index );
+        registry.layouts.emplace( SerialHash( entry.hash ).tail(), entry.index );
+    }
+
+    return registry;
+}
+
+/**
+ *
+ */
+inline const SerialRegistry& serial_registry() {
+
+    static const SerialRegistry registry = make_registry();
+    return registry;
+}
+
+/**
+ * Decisions whether registered layouts can be read as the type, keyed by the layout hash.
+ * A slot holds the layout hash, the decision and the valid bit in one word, so readers need no locks,
+ * concurrent misses compute the same decision and unknown layouts are not cached.
+ */
+template< typename T >
+struct SerialCompatibility {
+    static constexpr std::size_t slots = 64;
+
+    static uint32_t hash() {
+
+        static const uint32_t real_hash = SerialType< T >::hash();
+        return real_hash;
+    }
+
+    static bool match( uint32_t layout ) {
+
+        static std::atomic< uint64_t > table[ slots ];
+
+        uint64_t key = uint64_t( layout ) << 32;
+        std::size_t slot = layout % slots;
+
+        for ( std::size_t probe = 0; probe < slots; ++probe, slot = ( slot + 1 ) % slots ) {
+            uint64_t cached = table[ slot ].load( std::memory_order_acquire );
+            if ( cached == 0 )
+                break;
+            if ( ( cached & ~uint64_t( 3 ) ) == key )
+                return ( cached & 2 ) != 0;
+        }
+
+        auto entry = serial_registry().layout( layout );
+        if ( !entry )
+            return false;
+
+        bool decision = entry->match( hash() );
+        uint64_t value = key | ( decision ? 2 : 0 ) | 1;
+
+        for ( std::size_t probe = 0; probe < slots; ++probe, slot = ( slot + 1 ) % slots ) {
+            uint64_t expected = 0;
+            if ( table[ slot ].compare_exchange_strong( expected, value, std::memory_order_acq_rel ) ||
+                    ( expected & ~uint64_t( 3 ) ) == key )
+                break;
+        }
+
+        return decision;
+    }
+};
+
+/**
+ *
+ */
+template< typename Table >
+struct TableFunctor {
+    std::vector< typename Table::EntryType >& table;
+
+    template< std::size_t Index >
+    void operator()( size_t_< Index > ) {
+        table[ Index ] = &Table::template entry< Index >;
+    }
+};
+
+/**
+ *
+ */
+template< typename Table >
+inline const std::vector< typename Table::EntryType >& serial_table() {
+
+    static const std::vector< typename Table::EntryType > table = [] {
+        std::vector< typename Table::EntryType > table( count_serial() );
+        TableFunctor< Table > functor{ table };
+        foreach_serial( functor );
+        return table;
+    }();
+    return table;
+}
+
+}} // --- namespace
@@ -0,0 +1,74 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Containers with other allocators are left as is.
+ */
+template< typename ValueType, typename Allocator = typename ValueType::allocator_type >
+struct rebind_resource {
+    static void apply( ValueType& value ) {}
+};
+
+#if defined( SERIAL_MEMORY_RESOURCE )
+
+/**
+ * Memory resource of the current parse call, null if the container keeps its own.
+ */
+inline std::pmr::memory_resource*& serial_resource() {
+
+    static thread_local std::pmr::memory_resource* resource = nullptr;
+    return resource;
+}
+
+/**
+ *
+ */
+struct ResourceScope {
+    std::pmr::memory_resource* previous;
+
+    explicit ResourceScope( std::pmr::memory_resource* resource ) :
+            previous( serial_resource() ) {
+        serial_resource() = resource;
+    }
+
+    ~ResourceScope() {
+        serial_resource() = previous;
+    }
+};
+
+/**
+ * The allocator of a polymorphic container cannot be replaced after construction,
+ * so an empty container is constructed anew on the requested resource.
+ */
+template< typename ValueType, typename DataType >
+struct rebind_resource< ValueType, std::pmr::polymorphic_allocator< DataType > > {
+    static void apply( ValueType& value ) {
+
+        std::pmr::memory_resource* resource = serial_resource();
+        if ( !resource || *value.get_allocator().resource() == *resource )
+            return;
+
+        value.~ValueType();
+        ::new( static_cast< void* >( &value ) ) ValueType( typename ValueType::allocator_type( resource ) );
+    }
+};
+
+#endif
+
+}} // --- namespace
@@ -0,0 +1,194 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+struct ScanProgram;
+
+/**
+ * Bytes - fixed number of bytes.
+ * Range - length prefix followed by elements of fixed size.
+ * Sequence - length prefix followed by elements described by another program.
+ * Repeat - fixed number of elements described by another program.
+ * Index - sequence preceded by offsets of every size elements if it is longer than size elements.
+ * Bits - length prefix followed by bits packed into bytes.
+ * Optional - presence flag followed by the element described by another program if it is set.
+ * Variant - index followed by the alternative described by the program of one of size next ops.
+ * Shared - reference to a preceding object, or a new object described by another program.
+ * Prefix is the width of length prefix in bytes.
+ */
+struct ScanOp {
+    enum ScanCode : uint8_t {
+        Bytes,
+        Range,
+        Sequence,
+        Repeat,
+        Index,
+        Bits,
+        Optional,
+        Variant,
+        Shared
+    };
+
+    ScanCode code;
+    std::size_t size;
+    std::size_t prefix;
+    const ScanProgram& ( *program )();
+};
+
+/**
+ *
+ */
+struct ScanProgram : std::vector< ScanOp > {
+    void bytes( std::size_t size ) {
+
+        if ( size == 0 )
+            return;
+
+        if ( !empty() && back().code == ScanOp::Bytes )
+            back().size += size;
+        else
+            push_back( ScanOp{ ScanOp::Bytes, size, 0, nullptr } );
+    }
+
+    void range( std::size_t size, std::size_t prefix ) {
+
+        push_back( ScanOp{ ScanOp::Range, size, prefix, nullptr } );
+    }
+
+    void bits( std::size_t prefix ) {
+
+        push_back( ScanOp{ ScanOp::Bits, 1, prefix, nullptr } );
+    }
+
+    template< typename T >
+    void sequence( std::size_t prefix );
+
+    template< typename T >
+    void repeat( std::size_t size );
+
+    template< typename T >
+    void index( std::size_t size, std::size_t prefix );
+
+    template< typename T >
+    void optional();
+
+    template< typename ... Args >
+    void variant();
+
+    template< typename T >
+    void shared( std::size_t prefix );
+
+    /**
+     * Returns the size of elements without variable parts, otherwise zero.
+     */
+    std::size_t fixed() const {
+
+        return size() == 1 && front().code == ScanOp::Bytes ? front().size : 0;
+    }
+};
+
+/**
+ * Programs are built lazily and refer to each other through getters, which allows recursive types.
+ */
+template< typename T >
+const ScanProgram& scan_program() {
+
+    static const ScanProgram program = [] {
+        ScanProgram program;
+        SerialType< T >::scan( program );
+        return program;
+    }();
+
+    return program;
+}
+
+template< typename T >
+void ScanProgram::sequence( std::size_t prefix ) {
+
+    push_back( ScanOp{ ScanOp::Sequence, 0, prefix, &scan_program< T > } );
+}
+
+template< typename T >
+void ScanProgram::repeat( std::size_t size ) {
+
+    if ( size != 0 )
+        push_back( ScanOp{ ScanOp::Repeat, size, 0, &scan_program< T > } );
+}
+
+template< typename T >
+void ScanProgram::index( std::size_t size, std::size_t prefix ) {
+
+    push_back( ScanOp{ ScanOp::Index, size, prefix, &scan_program< T > } );
+}
+
+template< typename T >
+void ScanProgram::optional() {
+
+    push_back( ScanOp{ ScanOp::Optional, 0, sizeof( uint8_t ), &scan_program< T > } );
+}
+
+template< typename T >
+void ScanProgram::shared( std::size_t prefix ) {
+
+    push_back( ScanOp{ ScanOp::Shared, 0, prefix, &scan_program< T > } );
+}
+
+/**
+ * Alternatives follow the op as single repeats, so the decoder takes the program of the selected one.
+ */
+template< typename ... Args >
+void ScanProgram::variant() {
+
+    push_back( ScanOp{ ScanOp::Variant, sizeof...( Args ), sizeof( uint8_t ), nullptr } );
+
+    for ( auto program : { &scan_program< Args >... } )
+        push_back( ScanOp{ ScanOp::Repeat, 1, 0, program } );
+}
+
+/**
+ * Checks whether data of the program may refer to shared objects written before it.
+ */
+inline bool scan_shared( const ScanProgram& program, std::vector< const ScanProgram* >& visited ) {
+
+    if ( std::find( visited.begin(), visited.end(), &program ) != visited.end() )
+        return false;
+
+    visited.push_back( &program );
+
+    for ( const auto& op : program ) {
+        if ( op.code == ScanOp::Shared )
+            return true;
+        if ( op.program && scan_shared( op.program(), visited ) )
+            return true;
+    }
+
+    return false;
+}
+
+template< typename T >
+bool scan_shared() {
+
+    static const bool shared = [] {
+        std::vector< const ScanProgram* > visited;
+        return scan_shared( scan_program< T >(), visited );
+    }();
+
+    return shared;
+}
+
+}} // --- namespace
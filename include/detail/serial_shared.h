@@ -0,0 +1,97 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Identifies the type of shared objects, so a reference is never resolved to an object of another type.
+ */
+template< typename T >
+const void* shared_tag() {
+
+    static const char tag = 0;
+    return &tag;
+}
+
+/**
+ * Objects of the current serialize or parse call numbered in the order of their first occurrence.
+ * Written objects are found by address, read objects are found by number, count is the number of written objects.
+ */
+struct SharedTable {
+    struct WrittenEntry {
+        uint32_t number;
+        const void* tag;
+    };
+
+    struct ReadEntry {
+        std::shared_ptr< void > object;
+        const void* tag;
+    };
+
+    std::unordered_map< const void*, WrittenEntry > written;
+    std::vector< ReadEntry > read;
+    std::size_t count = 0;
+};
+
+/**
+ *
+ */
+inline SharedTable*& serial_shared() {
+
+    static thread_local SharedTable* table = nullptr;
+    return table;
+}
+
+/**
+ * Every pass over the data starts with an empty table, so sizing and writing make the same choices.
+ */
+struct SharedScope {
+    SharedTable* previous;
+    SharedTable table;
+
+    SharedScope() :
+            previous( serial_shared() ) {
+        serial_shared() = &table;
+    }
+
+    ~SharedScope() {
+        serial_shared() = previous;
+    }
+
+    SharedScope( const SharedScope& ) = delete;
+    SharedScope& operator=( const SharedScope& ) = delete;
+};
+
+/**
+ * Keeps the table of written objects to restore it after the data is sized ahead of writing.
+ */
+struct SharedRollback {
+    SharedTable* table;
+    SharedTable saved;
+
+    explicit SharedRollback( bool enabled ) :
+            table( enabled ? serial_shared() : nullptr ),
+            saved( table ? *table : SharedTable() ) {
+    }
+
+    void restore() {
+        if ( table )
+            *table = std::move( saved );
+    }
+};
+
+}} // --- namespace
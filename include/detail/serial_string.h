@@ -23,9 +23,12 @@ namespace detail {
 template< typename ... Args >
 struct SerialType< basic_string< Args... >, is_primitive< typename basic_string< Args... >::value_type > > {
     using ValueType = basic_string< Args... >;
-    using SizeType = uint32_t;
+    using SizeType = typename rebind_size< ValueType >::SizeType;
     using DataType = typename ValueType::value_type;
 
+    static_assert( std::is_integral< SizeType >::value && std::is_unsigned< SizeType >::value,
+        "length prefix must be an unsigned integer" );
+
     /**
      *
      */
@@ -59,6 +62,22 @@ struct SerialType< basic_string< Args... >, is_primitive< typename basic_string<
         return sizeof( SizeType );
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
     /**
      *
      */
@@ -74,36 +93,53 @@ struct SerialType< basic_string< Args... >, is_primitive< typename basic_string<
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        begin.bout( SizeType( value.size() ) );
+        begin.bout( &value[ 0 ], value.size() );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
         SizeType data_size;
-        begin.bin( data_size );
+        begin.bin( data_size, end );
 
-        if ( std::ptrdiff_t( sizeof( DataType ) * data_size ) > std::distance( begin, end ) )
+        if ( size_overflow( begin, end, data_size, sizeof( DataType ) ) )
             throw SerialException( SerialException::ExcBufferOverflow );
 
+        rebind_resource< ValueType >::apply( value );
         value.resize( data_size );
-        begin += sizeof( DataType ) * data_size;
+        begin.bin( &value[ 0 ], data_size, end );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
 
-        begin.bout( SizeType( value.size() ) );
-        begin.bout( &value[ 0 ], value.size() );
+        SizeType data_size;
+        begin.bin( data_size, end );
+
+        if ( size_overflow( begin, end, data_size, sizeof( DataType ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        begin.template skip< DataType >( data_size, end );
     }
 
     /**
      *
      */
-    template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void scan( ScanProgram& program ) {
 
-        begin += sizeof( SizeType );
-        begin.bin( &value[ 0 ], value.size() );
+        program.range( sizeof( DataType ), sizeof( SizeType ) );
     }
 
     /**
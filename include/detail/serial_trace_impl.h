@@ -20,33 +20,39 @@ namespace detail {
 /**
  *
  */
-template< typename Stream, typename Iterator >
-struct TraceFunctor {
-    Stream& stream;
-    Iterator& begin;
-    uint64_t size;
-    uint64_t hash;
+template< typename Stream, typename Iterator, SerialEncoding encoding = FixedEncoding >
+struct TraceTable {
+    using EntryType = void ( * )( Stream&, Iterator&, uint64_t );
 
     template< std::size_t Index >
-    constexpr bool operator()( size_t_< Index > ) {
+    static void entry( Stream& stream, Iterator& begin, uint64_t size ) {
         using ValueType = typename SerialIdentity< Index >::ValueType;
-        if ( serial_hash< ValueType >() != hash )
-            return false;
-        if ( SerialType< ValueType >::size() > size )
-            return true;
-        using IteratorType = typename Iterator::iterator;
-        constexpr auto serial_order = Iterator::order;
-        auto serial_begin_copy = SerialMetatype< ValueType >::template iterator< serial_order >( IteratorType( begin ) );
-        auto serial_begin = SerialMetatype< ValueType >::template iterator< serial_order >( IteratorType( begin ) );
-        auto serial_end = SerialMetatype< ValueType >::template iterator< serial_order >( IteratorType( begin + size ) );
         ValueType value{};
-        SerialType< ValueType >::init( value, serial_begin, serial_end );
-        SerialType< ValueType >::bin( value, serial_begin_copy );
-        SerialType< ValueType >::debug( value, stream, 0 );
-        return true;
+        if ( bin_entry< ValueType, encoding >( value, begin, size ) )
+            SerialType< ValueType >::debug( value, stream, 0 );
     }
 };
 
+/**
+ * Messages held by std::string and printed to standard streams go through the entry of the registered type.
+ */
+template< typename ByteArray, typename Iterator, typename Stream >
+static void trace_entry( const SerialEntry& entry, const ByteArray& bytes, Iterator& begin, Stream& stream, std::true_type ) {
+
+    entry.trace( bytes, stream );
+}
+
+template< typename ByteArray, typename Iterator, typename Stream >
+static void trace_entry( const SerialEntry& entry, const ByteArray& bytes, Iterator& begin, Stream& stream, std::false_type ) {
+
+    constexpr auto serial_coding = rebind_encoding< ByteArray >::internal_encoding;
+    constexpr auto trailer_size = rebind_checksum< ByteArray >::trailer_size;
+
+    using TableType = TraceTable< Stream, Iterator, serial_coding >;
+    serial_table< TableType >()[ entry.index ]( stream, begin,
+        bytes.size() - SerialType< uint64_t >::size() - trailer_size );
+}
+
 } // --- namespace
 
 /**
@@ -65,19 +71,29 @@ template< typename ByteArray, typename Stream >
 void trace( const ByteArray& bytes, Stream&& stream ) {
 
     try {
-        if ( detail::SerialType< uint64_t >::size() > bytes.size() )
+        constexpr auto trailer_size = detail::rebind_checksum< ByteArray >::trailer_size;
+        if ( detail::SerialType< uint64_t >::size() + trailer_size > bytes.size() )
             return;
 
         using IteratorType = detail::SerialIteratorConstAlias< ByteArray >;
         IteratorType begin( bytes.begin() );
+        IteratorType end( bytes.end() );
 
         uint64_t hash;
-        detail::SerialType< uint64_t >::bin( hash, begin );
+        detail::SerialType< uint64_t >::bin( hash, begin, end );
+
+        constexpr auto serial_coding = detail::rebind_encoding< ByteArray >::internal_encoding;
+        if ( serial_coding == CompactEncoding )
+            hash ^= SERIAL_COMPACT_SALT;
+
+        auto entry = detail::serial_registry().find( hash );
+        if ( !entry )
+            return;
 
         using StreamType = typename std::remove_reference< Stream >::type;
-        detail::TraceFunctor< StreamType, IteratorType > functor{ stream, begin,
-            bytes.size() - detail::SerialType< uint64_t >::size(), hash };
-        search_serial( functor );
+        using EntryTag = std::integral_constant< bool, std::is_same< ByteArray, std::string >::value &&
+            std::is_base_of< std::ostream, StreamType >::value >;
+        detail::trace_entry( *entry, bytes, begin, static_cast< StreamType& >( stream ), EntryTag{} );
     }
     catch ( const SerialException& ) {
         return;
@@ -79,6 +79,39 @@ using ratio = std::ratio< Num, Den >;
 template< typename Arg >
 using complex = std::complex< Arg >;
 
+template< typename First, typename Second >
+using pair = std::pair< First, Second >;
+
+template< typename ... Args >
+using map = std::map< Args... >;
+
+template< typename ... Args >
+using set = std::set< Args... >;
+
+template< typename ... Args >
+using unordered_map = std::unordered_map< Args... >;
+
+template< typename ... Args >
+using unordered_set = std::unordered_set< Args... >;
+
+template< typename Arg >
+using shared_ptr = std::shared_ptr< Arg >;
+
+template< typename Arg >
+using unique_ptr = std::unique_ptr< Arg >;
+
+#if __cplusplus >= 201703L
+
+template< typename Arg >
+using optional = std::optional< Arg >;
+
+template< typename ... Args >
+using variant = std::variant< Args... >;
+
+using monostate = std::monostate;
+
+#endif
+
 template< std::size_t Index >
 struct size_t_ : std::integral_constant< std::size_t, Index > {};
 
@@ -113,11 +146,61 @@ struct rebind_endian {
     static constexpr SerialEndian internal_endian = endian_traits< DefaultEndian >::internal_endian;
 };
 
-template< typename ByteArray, SerialEndian endian >
-struct rebind_endian< SerialWrapper< ByteArray, endian >, std::true_type > {
+template< typename ByteArray, SerialEndian endian, SerialEncoding encoding, SerialChecksum checksum >
+struct rebind_endian< SerialWrapper< ByteArray, endian, encoding, checksum >, std::true_type > {
     static constexpr SerialEndian internal_endian = endian_traits< endian >::internal_endian;
 };
 
+/**
+ * Type of length prefix of a dynamic array.
+ */
+template< typename T >
+struct rebind_size {
+    using SizeType = SERIAL_SIZE_TYPE;
+};
+
+/**
+ * Number of elements per chunk of the offset index of a vector, zero if the vector has no index.
+ */
+template< typename T >
+struct rebind_index {
+    static constexpr std::size_t chunk = 0;
+};
+
+/**
+ * Unordered containers are written in iteration order unless they are declared canonical.
+ */
+template< typename T >
+struct rebind_canonical : std::false_type {};
+
+/**
+ *
+ */
+template< typename T, typename = std::true_type >
+struct rebind_encoding {
+    static constexpr SerialEncoding internal_encoding = FixedEncoding;
+};
+
+template< typename ByteArray, SerialEndian endian, SerialEncoding encoding, SerialChecksum checksum >
+struct rebind_encoding< SerialWrapper< ByteArray, endian, encoding, checksum >, std::true_type > {
+    static constexpr SerialEncoding internal_encoding = encoding;
+};
+
+/**
+ * Size of the checksum trailer following the data.
+ */
+template< typename T, typename = std::true_type >
+struct rebind_checksum {
+    static constexpr SerialChecksum internal_checksum = NoChecksum;
+    static constexpr std::size_t trailer_size = 0;
+};
+
+template< typename ByteArray, SerialEndian endian, SerialEncoding encoding, SerialChecksum checksum >
+struct rebind_checksum< SerialWrapper< ByteArray, endian, encoding, checksum >, std::true_type > {
+    static constexpr SerialChecksum internal_checksum = checksum;
+    static constexpr std::size_t trailer_size = checksum == NoChecksum ? 0 : sizeof( uint32_t );
+};
+
 /**
  *
  */
@@ -159,6 +242,14 @@ using is_primitive = std::integral_constant< bool,
         std::is_arithmetic< T >::value ||
         std::is_enum< T >::value >;
 
+/**
+ * Booleans of vectors are packed into bits, so they are not stored as primitive elements.
+ */
+template< typename T >
+using is_primitive_element = std::integral_constant< bool,
+        is_primitive< T >::value &&
+        !std::is_same< T, bool >::value >;
+
 template< typename T >
 using is_integer_signed = std::integral_constant< bool,
         primitive_traits< T >::value &&
@@ -267,6 +358,63 @@ struct serial_traits< ratio< Num, Den > > : std::false_type {
     static constexpr uint32_t internal_ident = 11;
 };
 
+/**
+ * Pair has the layout of tuple, ordered and unordered containers of the same elements have the same layout.
+ */
+template< typename First, typename Second >
+struct serial_traits< pair< First, Second > > : std::false_type {
+    static constexpr uint32_t internal_ident = 10;
+};
+
+template< typename ... Args >
+struct serial_traits< map< Args... > > : std::false_type {
+    static constexpr uint32_t internal_ident = 15;
+};
+
+template< typename ... Args >
+struct serial_traits< unordered_map< Args... > > : std::false_type {
+    static constexpr uint32_t internal_ident = 15;
+};
+
+template< typename ... Args >
+struct serial_traits< set< Args... > > : std::false_type {
+    static constexpr uint32_t internal_ident = 16;
+};
+
+template< typename ... Args >
+struct serial_traits< unordered_set< Args... > > : std::false_type {
+    static constexpr uint32_t internal_ident = 16;
+};
+
+template< typename Arg >
+struct serial_traits< shared_ptr< Arg > > : std::false_type {
+    static constexpr uint32_t internal_ident = 17;
+};
+
+template< typename Arg >
+struct serial_traits< unique_ptr< Arg > > : std::false_type {
+    static constexpr uint32_t internal_ident = 18;
+};
+
+#if __cplusplus >= 201703L
+
+template< typename Arg >
+struct serial_traits< optional< Arg > > : std::false_type {
+    static constexpr uint32_t internal_ident = 12;
+};
+
+template< typename ... Args >
+struct serial_traits< variant< Args... > > : std::false_type {
+    static constexpr uint32_t internal_ident = 13;
+};
+
+template<>
+struct serial_traits< monostate > : std::false_type {
+    static constexpr uint32_t internal_ident = 14;
+};
+
+#endif
+
 /**
  *
  */
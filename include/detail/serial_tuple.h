@@ -63,11 +63,32 @@ struct SerialType< tuple< Args... >, std::true_type > {
         return functor.size;
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        FixedFunctor functor{ true };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
+        return functor.fixed;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
     /**
      *
      */
     static std::size_t size( const ValueType& value ) {
 
+        if ( fixed() )
+            return size();
+
         SizeFunctor functor{ const_cast< ValueType& >( value ), 0 };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
         return functor.size;
@@ -77,10 +98,9 @@ struct SerialType< tuple< Args... >, std::true_type > {
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
 
-        Iterator least_end = end - size();
-        InitFunctor< Iterator > functor{ value, begin, least_end };
+        BoutFunctor< Iterator > functor{ const_cast< ValueType& >( value ), begin };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
     }
 
@@ -88,9 +108,10 @@ struct SerialType< tuple< Args... >, std::true_type > {
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
-        BoutFunctor< Iterator > functor{ const_cast< ValueType& >( value ), begin };
+        Iterator least_end = end - Iterator::least( size() );
+        BinFunctor< Iterator > functor{ value, begin, least_end };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
     }
 
@@ -98,9 +119,19 @@ struct SerialType< tuple< Args... >, std::true_type > {
      *
      */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
 
-        BinFunctor< Iterator > functor{ value, begin };
+        Iterator least_end = end - Iterator::least( size() );
+        SkipFunctor< Iterator > functor{ begin, least_end };
+        foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        ScanFunctor functor{ program };
         foreach_sequence( functor, size_t_< 0 >{}, size_t_< tuple_size >{} );
     }
 
@@ -159,6 +190,18 @@ struct SerialType< tuple< Args... >, std::true_type > {
         }
     };
 
+    /**
+     *
+     */
+    struct FixedFunctor {
+        bool fixed;
+
+        template< std::size_t Index >
+        constexpr void operator()( size_t_< Index > ) {
+            fixed = fixed && SerialType< FieldType< Index > >::fixed();
+        }
+    };
+
     /**
      *
      */
@@ -176,15 +219,13 @@ struct SerialType< tuple< Args... >, std::true_type > {
      *
      */
     template< typename Iterator >
-    struct InitFunctor {
+    struct BoutFunctor {
         ValueType& value;
         Iterator& begin;
-        Iterator& end;
 
         template< std::size_t Index >
         constexpr void operator()( size_t_< Index > ) {
-            end += SerialType< FieldType< Index > >::size();
-            SerialType< FieldType< Index > >::init( std::get< Index >( value ), begin, end );
+            SerialType< FieldType< Index > >::bout( std::get< Index >( value ), begin );
         }
     };
 
@@ -192,13 +233,15 @@ struct SerialType< tuple< Args... >, std::true_type > {
      *
      */
     template< typename Iterator >
-    struct BoutFunctor {
+    struct BinFunctor {
         ValueType& value;
         Iterator& begin;
+        Iterator& end;
 
         template< std::size_t Index >
         constexpr void operator()( size_t_< Index > ) {
-            SerialType< FieldType< Index > >::bout( std::get< Index >( value ), begin );
+            end += Iterator::least( SerialType< FieldType< Index > >::size() );
+            SerialType< FieldType< Index > >::bin( std::get< Index >( value ), begin, end );
         }
     };
 
@@ -206,13 +249,26 @@ struct SerialType< tuple< Args... >, std::true_type > {
      *
      */
     template< typename Iterator >
-    struct BinFunctor {
-        ValueType& value;
+    struct SkipFunctor {
         Iterator& begin;
+        Iterator& end;
+
+        template< std::size_t Index >
+        constexpr void operator()( size_t_< Index > ) {
+            end += Iterator::least( SerialType< FieldType< Index > >::size() );
+            SerialType< FieldType< Index > >::skip( begin, end );
+        }
+    };
+
+    /**
+     *
+     */
+    struct ScanFunctor {
+        ScanProgram& program;
 
         template< std::size_t Index >
         constexpr void operator()( size_t_< Index > ) {
-            SerialType< FieldType< Index > >::bin( std::get< Index >( value ), begin );
+            SerialType< FieldType< Index > >::scan( program );
         }
     };
 
@@ -0,0 +1,318 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if __cplusplus >= 201703L
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Builds the array of entries of the table for every index at compile time.
+ */
+template< typename Table, std::size_t ... Index >
+constexpr std::array< typename Table::EntryType, sizeof...( Index ) > variant_table( std::index_sequence< Index... > ) {
+
+    return {{ &Table::template entry< Index >... }};
+}
+
+/**
+ *
+ */
+template<>
+struct SerialType< monostate, std::true_type > {
+    using ValueType = monostate;
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        hash_combine( value, serial_traits< ValueType >::internal_ident );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return 0;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return true;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        return 0;
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+    }
+
+    /**
+     *
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data;
+    }
+};
+
+/**
+ * Index of the alternative is followed by its value, reading dispatches the index through the table of alternatives.
+ */
+template< typename ... Args >
+struct SerialType< variant< Args... >, std::true_type > {
+    using ValueType = variant< Args... >;
+    using IndexType = uint8_t;
+    static constexpr std::size_t variant_size = sizeof...( Args );
+
+    static_assert( variant_size <= std::numeric_limits< IndexType >::max(), "Too many alternatives of variant" );
+
+    template< std::size_t Index >
+    using FieldType = std::variant_alternative_t< Index, ValueType >;
+
+    /**
+     *
+     */
+    static constexpr bool match( uint32_t value ) {
+
+        return hash() == value;
+    }
+
+    /**
+     *
+     */
+    static constexpr uint32_t hash() {
+
+        uint32_t real_hash = SERIAL_HASH_SALT;
+        hash( real_hash );
+        return real_hash;
+    }
+
+    static constexpr void hash( uint32_t& value, std::size_t nesting = SERIAL_NESTING_LIMIT ) {
+
+        hash_combine( value, serial_traits< ValueType >::internal_ident );
+        ( SerialType< Args >::hash( value, nesting ), ... );
+    }
+
+    /**
+     *
+     */
+    static constexpr std::size_t size() {
+
+        return sizeof( IndexType ) + std::min( { SerialType< Args >::size()... } );
+    }
+
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static std::size_t size( const ValueType& value ) {
+
+        return sizeof( IndexType ) + std::visit( []( const auto& data ) {
+            return SerialType< std::decay_t< decltype( data ) > >::size( data );
+        }, value );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        if ( value.valueless_by_exception() )
+            throw std::bad_variant_access();
+
+        IndexType index = IndexType( value.index() );
+        begin.bout( index );
+
+        std::visit( [ &begin ]( const auto& data ) {
+            SerialType< std::decay_t< decltype( data ) > >::bout( data, begin );
+        }, value );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
+
+        static constexpr auto table = variant_table< BinTable< Iterator > >( std::make_index_sequence< variant_size >{} );
+        table[ bin_index( begin, end ) ]( value, begin, end );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void skip( Iterator& begin, Iterator& end ) {
+
+        static constexpr auto table = variant_table< SkipTable< Iterator > >( std::make_index_sequence< variant_size >{} );
+        table[ bin_index( begin, end ) ]( begin, end );
+    }
+
+    /**
+     *
+     */
+    static void scan( ScanProgram& program ) {
+
+        program.variant< Args... >();
+    }
+
+    /**
+     *
+     */
+    template< typename Stream >
+    static void debug( const ValueType& value, Stream& stream, uint8_t level ) {
+
+        stream << SerialMetatype< ValueType >::alias().data << ": ";
+
+        if ( value.valueless_by_exception() ) {
+            stream << "valueless";
+            return;
+        }
+
+        stream << "[" << value.index() << "] ";
+
+        std::visit( [ &stream, level ]( const auto& data ) {
+            SerialType< std::decay_t< decltype( data ) > >::debug( data, stream, level );
+        }, value );
+    }
+
+    /**
+     * Reads the index of the alternative and checks that the least size of it follows.
+     */
+    template< typename Iterator >
+    static std::size_t bin_index( Iterator& begin, Iterator& end ) {
+
+        static constexpr std::size_t sizes[] = { SerialType< Args >::size()... };
+
+        IndexType index;
+        begin.bin( index, end );
+
+        if ( index >= variant_size )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
+
+        if ( size_overflow( begin, end, 1, sizes[ index ] ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        return index;
+    }
+
+    /**
+     * Held alternative is read in place, so its storage is reused.
+     */
+    template< typename Iterator >
+    struct BinTable {
+        using EntryType = void ( * )( ValueType&, Iterator&, Iterator& );
+
+        template< std::size_t Index >
+        static void entry( ValueType& value, Iterator& begin, Iterator& end ) {
+            if ( value.index() != Index )
+                value.template emplace< Index >();
+            SerialType< FieldType< Index > >::bin( std::get< Index >( value ), begin, end );
+        }
+    };
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    struct SkipTable {
+        using EntryType = void ( * )( Iterator&, Iterator& );
+
+        template< std::size_t Index >
+        static void entry( Iterator& begin, Iterator& end ) {
+            SerialType< FieldType< Index > >::skip( begin, end );
+        }
+    };
+};
+
+}} // --- namespace
+
+#endif
@@ -0,0 +1,162 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace memserial {
+namespace detail {
+
+/**
+ * Character types hold code units rather than numbers, so they keep their width.
+ */
+template< typename T >
+struct varint_character : std::integral_constant< bool,
+        std::is_same< T, wchar_t >::value || std::is_same< T, char16_t >::value || std::is_same< T, char32_t >::value > {
+};
+
+/**
+ * Integers wider than a byte are written as LEB128 varints, signed integers are zigzag encoded before.
+ */
+template< typename T, typename = std::true_type >
+struct varint_traits : std::false_type {
+};
+
+template< typename T >
+struct varint_traits< T, std::integral_constant< bool, std::is_integral< T >::value && ( sizeof( T ) > 1 ) &&
+        !varint_character< T >::value > > : std::true_type {
+    using UnsignedType = typename std::make_unsigned< T >::type;
+
+    static constexpr std::size_t bits = sizeof( T ) * CHAR_BIT;
+    static constexpr std::size_t max_size = ( bits + 6 ) / 7;
+
+    static UnsignedType encode( T value ) {
+
+        if ( !std::is_signed< T >::value )
+            return UnsignedType( value );
+
+        return UnsignedType( UnsignedType( value ) << 1 ) ^ ( value < 0 ? UnsignedType( -1 ) : UnsignedType( 0 ) );
+    }
+
+    static T decode( UnsignedType value ) {
+
+        if ( !std::is_signed< T >::value )
+            return T( value );
+
+        return T( UnsignedType( value >> 1 ) ^ ( value & 1 ? UnsignedType( -1 ) : UnsignedType( 0 ) ) );
+    }
+
+    static std::size_t size( T value ) {
+
+        UnsignedType data = encode( value );
+        std::size_t size = 1;
+
+        while ( data >= 0x80 ) {
+            data >>= 7;
+            ++size;
+        }
+
+        return size;
+    }
+
+    static char* put( char* data, T value ) {
+
+        UnsignedType bytes = encode( value );
+
+        while ( bytes >= 0x80 ) {
+            *data++ = char( uint8_t( bytes ) | 0x80 );
+            bytes >>= 7;
+        }
+
+        *data++ = char( bytes );
+        return data;
+    }
+
+    /**
+     * Last byte of the longest value may only hold the remaining bits of the type.
+     */
+    static bool overlong( uint8_t byte, std::size_t shift ) {
+
+        return bits - shift < 7 && ( byte & 0x7f ) >> ( bits - shift ) != 0;
+    }
+
+    /**
+     * Reads the value without bounds checking, the buffer must fit the longest value.
+     */
+    static const char* get( T& value, const char* data ) {
+
+        UnsignedType bytes = 0;
+
+        for ( std::size_t shift = 0; shift < bits; shift += 7 ) {
+            uint8_t byte = uint8_t( *data++ );
+            if ( overlong( byte, shift ) )
+                throw SerialException( SerialException::ExcLayoutIncompatible );
+            bytes |= UnsignedType( UnsignedType( byte & 0x7f ) << shift );
+            if ( ( byte & 0x80 ) == 0 ) {
+                value = decode( bytes );
+                return data;
+            }
+        }
+
+        throw SerialException( SerialException::ExcLayoutIncompatible );
+    }
+
+    static const char* get( T& value, const char* data, const char* end ) {
+
+        if ( std::size_t( end - data ) >= max_size )
+            return get( value, data );
+
+        UnsignedType bytes = 0;
+
+        for ( std::size_t shift = 0; shift < bits; shift += 7 ) {
+            if ( data == end )
+                throw SerialException( SerialException::ExcBufferOverflow );
+            uint8_t byte = uint8_t( *data++ );
+            if ( overlong( byte, shift ) )
+                throw SerialException( SerialException::ExcLayoutIncompatible );
+            bytes |= UnsignedType( UnsignedType( byte & 0x7f ) << shift );
+            if ( ( byte & 0x80 ) == 0 ) {
+                value = decode( bytes );
+                return data;
+            }
+        }
+
+        throw SerialException( SerialException::ExcLayoutIncompatible );
+    }
+
+    /**
+     * Single byte values are decoded inline, bounds are checked only near the end of the buffer.
+     */
+    static const char* get( T* value, std::size_t size, const char* data, const char* end ) {
+
+        std::size_t index = 0;
+
+        for ( ; index < size && std::size_t( end - data ) >= max_size; ++index ) {
+            uint8_t byte = uint8_t( *data );
+            if ( ( byte & 0x80 ) == 0 ) {
+                value[ index ] = decode( byte );
+                ++data;
+            }
+            else {
+                data = get( value[ index ], data );
+            }
+        }
+
+        for ( ; index < size; ++index )
+            data = get( value[ index ], data, end );
+
+        return data;
+    }
+};
+
+}} // --- namespace
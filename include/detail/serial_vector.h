@@ -21,11 +21,14 @@ namespace detail {
  *
  */
 template< typename ... Args >
-struct SerialType< vector< Args... >, is_primitive< typename vector< Args... >::value_type > > {
+struct SerialType< vector< Args... >, is_primitive_element< typename vector< Args... >::value_type > > {
     using ValueType = vector< Args... >;
-    using SizeType = uint32_t;
+    using SizeType = typename rebind_size< ValueType >::SizeType;
     using DataType = typename ValueType::value_type;
 
+    static_assert( std::is_integral< SizeType >::value && std::is_unsigned< SizeType >::value,
+        "length prefix must be an unsigned integer" );
+
     /**
      *
      */
@@ -59,6 +62,22 @@ struct SerialType< vector< Args... >, is_primitive< typename vector< Args... >::
         return sizeof( SizeType );
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
     /**
      *
      */
@@ -74,36 +93,53 @@ struct SerialType< vector< Args... >, is_primitive< typename vector< Args... >::
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        begin.bout( SizeType( value.size() ) );
+        begin.bout( &value[ 0 ], value.size() );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
         SizeType data_size;
-        begin.bin( data_size );
+        begin.bin( data_size, end );
 
-        if ( std::ptrdiff_t( sizeof( DataType ) * data_size ) > std::distance( begin, end ) )
+        if ( size_overflow( begin, end, data_size, sizeof( DataType ) ) )
             throw SerialException( SerialException::ExcBufferOverflow );
 
+        rebind_resource< ValueType >::apply( value );
         value.resize( data_size );
-        begin += sizeof( DataType ) * data_size;
+        begin.bin( value.data(), data_size, end );
     }
 
     /**
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
 
-        begin.bout( SizeType( value.size() ) );
-        begin.bout( &value[ 0 ], value.size() );
+        SizeType data_size;
+        begin.bin( data_size, end );
+
+        if ( size_overflow( begin, end, data_size, sizeof( DataType ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        begin.template skip< DataType >( data_size, end );
     }
 
     /**
      *
      */
-    template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void scan( ScanProgram& program ) {
 
-        begin += sizeof( SizeType );
-        begin.bin( &value[ 0 ], value.size() );
+        program.range( sizeof( DataType ), sizeof( SizeType ) );
     }
 
     /**
@@ -137,9 +173,17 @@ struct SerialType< vector< Args... >, is_primitive< typename vector< Args... >::
 template< typename ... Args >
 struct SerialType< vector< Args... >, is_class< typename vector< Args... >::value_type > > {
     using ValueType = vector< Args... >;
-    using SizeType = uint32_t;
+    using SizeType = typename rebind_size< ValueType >::SizeType;
     using DataType = typename ValueType::value_type;
 
+    static constexpr std::size_t chunk = rebind_index< ValueType >::chunk;
+
+    static_assert( std::is_integral< SizeType >::value && std::is_unsigned< SizeType >::value,
+        "length prefix must be an unsigned integer" );
+
+    static_assert( chunk == 0 || !SerialType< DataType >::fixed(),
+        "offset index requires elements of variable size" );
+
     /**
      *
      */
@@ -163,6 +207,17 @@ struct SerialType< vector< Args... >, is_class< typename vector< Args... >::valu
         hash_combine( value, serial_traits< ValueType >::internal_ident );
         SerialType< SizeType >::hash( value, nesting );
         SerialType< DataType >::hash( value, nesting );
+
+        if ( chunk != 0 )
+            hash_combine( value, uint32_t( chunk ) );
+    }
+
+    /**
+     * Number of chunks in the offset index, zero if the vector is written without index.
+     */
+    static constexpr std::size_t chunks( uint64_t size ) {
+
+        return chunk != 0 && size > chunk ? std::size_t( ( size - 1 ) / chunk + 1 ) : 0;
     }
 
     /**
@@ -173,6 +228,22 @@ struct SerialType< vector< Args... >, is_class< typename vector< Args... >::valu
         return sizeof( SizeType );
     }
 
+    /**
+     *
+     */
+    static constexpr bool fixed() {
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    static constexpr bool trivial() {
+
+        return false;
+    }
+
     /**
      *
      */
@@ -181,6 +252,24 @@ struct SerialType< vector< Args... >, is_class< typename vector< Args... >::valu
         if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
             throw SerialException( SerialException::ExcArrayOverflow );
 
+        if ( SerialType< DataType >::fixed() )
+            return sizeof( SizeType ) + SerialType< DataType >::size() * value.size();
+
+        if ( chunks( value.size() ) != 0 ) {
+            std::vector< uint64_t > sizes = chunk_sizes< NativeEndian, FixedEncoding >( value, parallel() );
+            record_slices( value.data(), sizes );
+
+            std::size_t byte_size = sizeof( SizeType ) + sizeof( uint64_t ) * sizes.size();
+            for ( uint64_t chunk_size : sizes )
+                byte_size += std::size_t( chunk_size );
+
+            return byte_size;
+        }
+
+        std::size_t slices = parallel_slices( value.size(), parallel() );
+        if ( slices != 0 )
+            return sizeof( SizeType ) + parallel_size( value.data(), value.size(), slices );
+
         std::size_t byte_size = sizeof( SizeType );
 
         for ( const auto& data : value )
@@ -193,20 +282,65 @@ struct SerialType< vector< Args... >, is_class< typename vector< Args... >::valu
      *
      */
     template< typename Iterator >
-    static void init( ValueType& value, Iterator& begin, Iterator& end ) {
+    static void bout( const ValueType& value, Iterator& begin ) {
+
+        if ( value.size() > std::size_t( std::numeric_limits< SizeType >::max() ) )
+            throw SerialException( SerialException::ExcArrayOverflow );
+
+        begin.bout( SizeType( value.size() ) );
+
+        if ( SerialType< DataType >::trivial() && Iterator::native ) {
+            if ( !value.empty() )
+                begin.bout( reinterpret_cast< const char* >( value.data() ), sizeof( DataType ) * value.size() );
+            return;
+        }
+
+        if ( chunks( value.size() ) != 0 ) {
+            bout_index( value, begin );
+            return;
+        }
+
+        std::size_t slices = parallel_slices( value.size(), parallel_traits< Iterator >::value && parallel() );
+        if ( slices != 0 ) {
+            parallel_bout( value.data(), value.size(), slices, begin );
+            return;
+        }
+
+        for ( const auto& data : value )
+            SerialType< DataType >::bout( data, begin );
+    }
+
+    /**
+     *
+     */
+    template< typename Iterator >
+    static void bin( ValueType& value, Iterator& begin, Iterator& end ) {
 
         SizeType data_size;
-        begin.bin( data_size );
+        begin.bin( data_size, end );
 
-        if ( std::ptrdiff_t( SerialType< DataType >::size() * data_size ) > std::distance( begin, end ) )
+        if ( size_overflow( begin, end, data_size, SerialType< DataType >::size() ) )
             throw SerialException( SerialException::ExcBufferOverflow );
 
-        Iterator least_end = end - SerialType< DataType >::size() * data_size;
+        rebind_resource< ValueType >::apply( value );
         value.resize( data_size );
 
+        if ( SerialType< DataType >::trivial() && Iterator::native ) {
+            if ( data_size != 0 )
+                begin.bin( reinterpret_cast< char* >( value.data() ), sizeof( DataType ) * data_size );
+            return;
+        }
+
+        if ( chunks( data_size ) != 0 ) {
+            bin_index( value, begin, end );
+            return;
+        }
+
+        Iterator least_end = end - Iterator::least( SerialType< DataType >::size() ) * data_size;
+
         for ( auto& data : value ) {
-            least_end += SerialType< DataType >::size();
-            SerialType< DataType >::init( data, begin, least_end );
+            least_end += Iterator::least( SerialType< DataType >::size() );
+            SerialType< DataType >::bin( data, begin, least_end );
         }
     }
 
@@ -214,24 +348,171 @@ struct SerialType< vector< Args... >, is_class< typename vector< Args... >::valu
      *
      */
     template< typename Iterator >
-    static void bout( const ValueType& value, Iterator& begin ) {
+    static void skip( Iterator& begin, Iterator& end ) {
 
-        begin.bout( SizeType( value.size() ) );
+        SizeType data_size;
+        begin.bin( data_size, end );
 
-        for ( const auto& data : value )
-            SerialType< DataType >::bout( data, begin );
+        if ( size_overflow( begin, end, data_size, SerialType< DataType >::size() ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        if ( chunks( data_size ) != 0 ) {
+            begin.template skip< uint64_t >( chunks( data_size ) - 1, end );
+            uint64_t elements_size;
+            begin.bin( elements_size, end );
+
+            if ( elements_size > uint64_t( std::distance( begin, end ) ) )
+                throw SerialException( SerialException::ExcBufferOverflow );
+
+            if ( parallel() || !serial_shared() ) {
+                begin += std::size_t( elements_size );
+                return;
+            }
+        }
+
+        Iterator least_end = end - Iterator::least( SerialType< DataType >::size() ) * data_size;
+
+        for ( SizeType index = 0; index < data_size; ++index ) {
+            least_end += Iterator::least( SerialType< DataType >::size() );
+            SerialType< DataType >::skip( begin, least_end );
+        }
     }
 
     /**
      *
      */
+    static void scan( ScanProgram& program ) {
+
+        if ( chunk != 0 )
+            program.index< DataType >( chunk, sizeof( SizeType ) );
+        else
+            program.sequence< DataType >( sizeof( SizeType ) );
+    }
+
+    /**
+     * Elements referring to shared objects depend on the preceding elements, so they are processed sequentially.
+     */
+    static bool parallel() {
+
+        return !scan_shared< DataType >();
+    }
+
+    /**
+     * Sizes of chunks, sized in parallel if an executor is set.
+     */
+    template< SerialEndian endian, SerialEncoding encoding >
+    static std::vector< uint64_t > chunk_sizes( const ValueType& value, bool enabled ) {
+
+        std::vector< uint64_t > sizes( chunks( value.size() ) );
+
+        parallel_for( sizes.size(), enabled, [ & ]( std::size_t first, std::size_t last ) {
+            for ( std::size_t index = first; index < last; ++index ) {
+                CountIterator< endian, encoding > counter{ 0 };
+                for ( std::size_t data = index * chunk; data < value.size() && data < ( index + 1 ) * chunk; ++data ) {
+                    if ( encoding == FixedEncoding )
+                        counter.count += SerialType< DataType >::size( value[ data ] );
+                    else
+                        SerialType< DataType >::bout( value[ data ], counter );
+                }
+                sizes[ index ] = counter.count;
+            }
+        } );
+
+        return sizes;
+    }
+
+    /**
+     * Offsets of ends of chunks relative to the first element, the last offset is the size of all elements.
+     * Chunks are sized unless their sizes were recorded while sizing the value,
+     * then written in parallel if an executor is set.
+     * Shared objects numbered while sizing are numbered anew while writing.
+     */
+    template< typename Iterator >
+    static void bout_index( const ValueType& value, Iterator& begin ) {
+
+        std::vector< uint64_t > offsets;
+
+        if ( const std::vector< uint64_t >* sizes = recorded_slices( value.data(), chunks( value.size() ) ) ) {
+            offsets = *sizes;
+        }
+        else {
+            SharedRollback rollback( !parallel() && !parallel_traits< Iterator >::counting );
+            offsets = chunk_sizes< Iterator::order, Iterator::coding >( value, parallel_traits< Iterator >::value && parallel() );
+            rollback.restore();
+
+            if ( parallel_traits< Iterator >::counting )
+                record_slices( value.data(), offsets );
+        }
+
+        for ( std::size_t index = 1; index < offsets.size(); ++index )
+            offsets[ index ] += offsets[ index - 1 ];
+
+        begin.bout( offsets.data(), offsets.size() );
+
+        if ( parallel_traits< Iterator >::counting ) {
+            parallel_traits< Iterator >::advance( begin, offsets.back() );
+            return;
+        }
+
+        if ( !parallel_traits< Iterator >::value ) {
+            for ( const auto& data : value )
+                SerialType< DataType >::bout( data, begin );
+            return;
+        }
+
+        parallel_for( offsets.size(), parallel(), [ & ]( std::size_t first, std::size_t last ) {
+            Iterator chunk_begin = begin;
+            parallel_traits< Iterator >::advance( chunk_begin, first == 0 ? 0 : offsets[ first - 1 ] );
+            for ( std::size_t data = first * chunk; data < value.size() && data < last * chunk; ++data )
+                SerialType< DataType >::bout( value[ data ], chunk_begin );
+        } );
+
+        parallel_traits< Iterator >::advance( begin, offsets.back() );
+    }
+
+    /**
+     * Every chunk is bounded by its offsets and must be decoded exactly up to the next one.
+     */
     template< typename Iterator >
-    static void bin( ValueType& value, Iterator& begin ) {
+    static void bin_index( ValueType& value, Iterator& begin, Iterator& end ) {
 
-        begin += sizeof( SizeType );
+        std::vector< uint64_t > offsets( chunks( value.size() ) );
+
+        if ( size_overflow( begin, end, offsets.size(), sizeof( uint64_t ) ) )
+            throw SerialException( SerialException::ExcBufferOverflow );
+
+        begin.bin( offsets.data(), offsets.size(), end );
+
+        uint64_t distance = uint64_t( std::distance( begin, end ) );
+        constexpr std::size_t least = Iterator::least( SerialType< DataType >::size() );
+
+        for ( std::size_t index = 0; index < offsets.size(); ++index ) {
+            uint64_t first = index == 0 ? 0 : offsets[ index - 1 ];
+            uint64_t count = std::min< uint64_t >( uint64_t( chunk ), value.size() - index * chunk );
+            if ( offsets[ index ] < first || offsets[ index ] - first < least * count || offsets[ index ] > distance )
+                throw SerialException( SerialException::ExcBufferOverflow );
+        }
 
-        for ( auto& data : value )
-            SerialType< DataType >::bin( data, begin );
+        parallel_for( offsets.size(), parallel_decode() && parallel(), [ & ]( std::size_t first, std::size_t last ) {
+            for ( std::size_t index = first; index < last; ++index ) {
+                std::size_t count = std::min( std::size_t( chunk ), value.size() - index * chunk );
+                Iterator chunk_begin = begin;
+                chunk_begin += std::size_t( index == 0 ? 0 : offsets[ index - 1 ] );
+                Iterator chunk_end = begin;
+                chunk_end += std::size_t( offsets[ index ] );
+
+                Iterator least_end = chunk_end - least * count;
+                for ( std::size_t data = index * chunk; data < index * chunk + count; ++data ) {
+                    least_end += least;
+                    SerialType< DataType >::bin( value[ data ], chunk_begin, least_end );
+                }
+
+                if ( chunk_begin != chunk_end )
+                    throw SerialException( SerialException::ExcLayoutIncompatible );
+            }
+        } );
+
+        begin += std::size_t( offsets.back() );
     }
 
     /**
@@ -18,56 +18,98 @@ namespace memserial {
 namespace detail {
 
 /**
- *
+ * Builds the registry at startup, so hash collisions are reported before the first call.
  */
-struct MatchFunctor {
-    bool match_result;
-    uint32_t match_hash;
-    uint32_t real_hash;
-
-    template< std::size_t Index >
-    constexpr bool operator()( size_t_< Index > ) {
-        using ValueType = typename SerialIdentity< Index >::ValueType;
-        if ( SerialType< ValueType >::hash() != real_hash )
-            return false;
-        match_result = SerialType< ValueType >::match( match_hash );
-        return true;
-    }
-};
+#if __cplusplus >= 201703L
+inline const SerialRegistry& serial_registry_static = serial_registry();
+#else
+static const SerialRegistry& serial_registry_static = serial_registry();
+#endif
 
 /**
  *
  */
-struct HashFunctor {
-    uint64_t hash;
-    const std::string& alias;
-
-    template< std::size_t Index >
-    constexpr bool operator()( size_t_< Index > ) {
-        using ValueType = typename SerialIdentity< Index >::ValueType;
-        if ( serial_alias< ValueType >() != alias )
-            return false;
-        hash = serial_hash< ValueType >();
-        return true;
+template< typename T, SerialEncoding encoding = FixedEncoding >
+static void check_hash( uint64_t hash ) {
+
+    uint32_t tail = SerialHash( hash ).tail() ^ ( encoding == CompactEncoding ? SERIAL_COMPACT_SALT : 0 );
+
+    if ( SerialMetatype< T >::alias().hash() != SerialHash( hash ).head() ) {
+        if ( !SerialCompatibility< T >::match( tail ) )
+            throw SerialException( SerialException::ExcLayoutIncompatible );
     }
-};
+
+    else if ( SerialCompatibility< T >::hash() == ( tail ^ SERIAL_COMPACT_SALT ) )
+        throw SerialException( SerialException::ExcEncodingIncompatible );
+
+    else if ( SerialCompatibility< T >::hash() != tail )
+        throw SerialException( SerialException::ExcBinaryIncompatible );
+}
 
 /**
- *
+ * Size of data in compact encoding is not known in advance, so it is counted by writing data to nowhere.
  */
-struct AliasFunctor {
-    std::string alias;
-    uint64_t hash;
+template< typename ByteArray, typename T >
+static std::size_t serial_size( const T& value ) {
 
-    template< std::size_t Index >
-    constexpr bool operator()( size_t_< Index > ) {
-        using ValueType = typename SerialIdentity< Index >::ValueType;
-        if ( serial_hash< ValueType >() != hash )
-            return false;
-        alias = serial_alias< ValueType >();
-        return true;
-    }
-};
+    constexpr auto serial_order = rebind_endian< ByteArray >::internal_endian;
+    constexpr auto serial_coding = rebind_encoding< ByteArray >::internal_encoding;
+
+    constexpr auto trailer_size = rebind_checksum< ByteArray >::trailer_size;
+
+    SharedScope scope;
+
+    if ( serial_coding == FixedEncoding )
+        return SerialType< uint64_t >::size() + SerialType< T >::size( value ) + trailer_size;
+
+    CountIterator< serial_order, serial_coding > begin{ 0 };
+    SerialType< T >::bout( value, begin );
+    return SerialType< uint64_t >::size() + begin.count + trailer_size;
+}
+
+/**
+ * Checksum is read from the end of the array, so arrays with checksum must have exactly the serialized size.
+ */
+template< typename ByteArray >
+static bool serial_fits( std::size_t size, std::size_t byte_size ) {
+
+    if ( rebind_checksum< ByteArray >::internal_checksum == NoChecksum )
+        return size <= byte_size;
+
+    return size == byte_size;
+}
+
+/**
+ * Checksum covers the hash header and data, it is written right after the data in the byte order of the array.
+ */
+template< typename ByteArray >
+static void bout_checksum( SerialIteratorAlias< ByteArray > begin, SerialIteratorAlias< ByteArray > end ) {
+
+    if ( rebind_checksum< ByteArray >::internal_checksum == NoChecksum )
+        return;
+
+    uint32_t checksum = crc32c_kernel::checksum( &begin, std::distance( begin, end ) );
+    SerialType< uint32_t >::bout( checksum, end );
+}
+
+/**
+ * Checksum is verified before decoding, so corrupted data is never decoded, the trailer is excluded from the data.
+ */
+template< typename ByteArray >
+static void bin_checksum( SerialIteratorConstAlias< ByteArray > begin, SerialIteratorConstAlias< ByteArray >& end ) {
+
+    if ( rebind_checksum< ByteArray >::internal_checksum == NoChecksum )
+        return;
+
+    end -= SerialType< uint32_t >::size();
+    SerialIteratorConstAlias< ByteArray > trailer( end );
+
+    uint32_t checksum;
+    trailer.bin( checksum );
+
+    if ( checksum != crc32c_kernel::checksum( &begin, std::distance( begin, end ) ) )
+        throw SerialException( SerialException::ExcChecksumMismatch );
+}
 
 } // --- namespace
 
@@ -78,8 +120,8 @@ template< typename ByteArray, typename T >
 ByteArray serialize( const T& value ) {
 
     ByteArray bytes;
-    bytes.resize( size( value ) );
-    serialize( bytes, value );
+    bytes.resize( detail::serial_size< ByteArray >( value ) );
+    serialize_unchecked( bytes, value );
     return bytes;
 }
 
@@ -89,22 +131,226 @@ ByteArray serialize( const T& value ) {
 template< typename ByteArray, typename T >
 void serialize( ByteArray& bytes, const T& value ) {
 
-    if ( size( value ) > bytes.size() )
+    if ( !detail::serial_fits< ByteArray >( detail::serial_size< ByteArray >( value ), bytes.size() ) )
         throw SerialException( SerialException::ExcBufferOverflow );
 
+    serialize_unchecked( bytes, value );
+}
+
+/**
+ *
+ */
+template< typename ByteArray, typename T >
+void serialize_unchecked( ByteArray& bytes, const T& value ) {
+
     using detail::SerialMetatype;
     using detail::SerialType;
 
     using SerialIteratorType = detail::SerialIteratorAlias< ByteArray >;
     SerialIteratorType begin( bytes.begin() );
 
-    SerialType< uint64_t >::bout( detail::serial_hash< T >(), begin );
+    constexpr auto serial_coding = detail::rebind_encoding< ByteArray >::internal_encoding;
+    SerialType< uint64_t >::bout( detail::serial_hash< T, serial_coding >(), begin );
 
     using IteratorType = typename SerialIteratorType::iterator;
     constexpr auto serial_order = SerialIteratorType::order;
-    auto serial_begin = SerialMetatype< T >::template iterator< serial_order >( IteratorType( begin ) );
+    auto serial_begin = SerialMetatype< T >::template iterator< serial_order, serial_coding >( IteratorType( begin ) );
+
+    detail::SharedScope scope;
+    SerialType< T >::bout( value, serial_begin );
+    detail::bout_checksum< ByteArray >( SerialIteratorType( bytes.begin() ), IteratorType( serial_begin ) );
+}
+
+/**
+ *
+ */
+template< typename T, std::size_t N, typename >
+void serialize( std::array< char, N >& bytes, const T& value ) {
+
+    serialize_unchecked( bytes, value );
+}
+
+/**
+ *
+ */
+template< typename T, std::size_t N, SerialEndian endian, typename >
+void serialize( SerialWrapper< std::array< char, N >, endian >& bytes, const T& value ) {
+
+    serialize_unchecked( bytes, value );
+}
+
+/**
+ *
+ */
+template< typename T, std::size_t N >
+void serialize( char ( &bytes )[ N ], const T& value ) {
+
+    static_assert( fixed< T >(), "type has no fixed size" );
+    static_assert( N >= fixed_size< T >(), "buffer is too small" );
+
+    SerialView view( bytes );
+    serialize_unchecked( view, value );
+}
+
+/**
+ *
+ */
+template< typename ByteArray, typename T >
+void serialize( ByteArray& bytes, const T& value, SerialExecutor& executor ) {
+
+    detail::ExecutorScope scope( &executor );
+    detail::SliceTable table;
+    detail::SliceScope slice_scope( &table );
+
+    if ( !detail::serial_fits< ByteArray >( detail::serial_size< ByteArray >( value ), bytes.size() ) )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    serialize_unchecked( bytes, value );
+}
+
+/**
+ *
+ */
+template< typename ByteArray, typename T >
+void append( ByteArray& bytes, const T& value, uint8_t flags ) {
+
+    using detail::SerialMetatype;
+    using detail::SerialType;
+    using LengthType = typename SerialFrame< ByteArray >::LengthType;
+
+    std::size_t length = detail::serial_size< ByteArray >( value );
+    if ( length > std::numeric_limits< LengthType >::max() )
+        throw SerialException( SerialException::ExcArrayOverflow );
+
+    using SerialIteratorType = detail::SerialIteratorAlias< ByteArray >;
+    constexpr auto serial_order = SerialIteratorType::order;
+    constexpr auto serial_coding = detail::rebind_encoding< ByteArray >::internal_encoding;
+    constexpr auto header_size = SerialFrame< ByteArray >::header_size;
+    std::size_t offset = bytes.size();
+
+    if ( flags & CompressedFrame ) {
+        constexpr auto serial_check = detail::rebind_checksum< ByteArray >::internal_checksum;
+        static thread_local SerialWrapper< std::string, serial_order, serial_coding, serial_check > window;
+        window.resize( length );
+        serialize_unchecked( window, value );
+
+        constexpr std::size_t prefix = SerialType< uint64_t >::size() + SerialType< LengthType >::size();
+        std::size_t payload = length - SerialType< uint64_t >::size();
+        bytes.resize( offset + header_size + prefix + detail::lz_bound( payload ) );
+
+        SerialIteratorType data( bytes.begin() + offset + header_size + prefix );
+        std::size_t packed = prefix + detail::lz_compress( &window[ SerialType< uint64_t >::size() ], payload, &data );
+        if ( packed > std::numeric_limits< LengthType >::max() ) {
+            bytes.resize( offset );
+            throw SerialException( SerialException::ExcArrayOverflow );
+        }
+
+        bytes.resize( offset + header_size + packed );
+        SerialIteratorType begin( bytes.begin() + offset );
+
+        SerialType< LengthType >::bout( LengthType( packed ), begin );
+        SerialType< uint8_t >::bout( flags, begin );
+        SerialType< uint64_t >::bout( detail::serial_hash< T, serial_coding >(), begin );
+        SerialType< LengthType >::bout( LengthType( payload ), begin );
+        return;
+    }
 
+    bytes.resize( offset + header_size + length );
+    SerialIteratorType begin( bytes.begin() + offset );
+
+    SerialType< LengthType >::bout( LengthType( length ), begin );
+    SerialType< uint8_t >::bout( flags, begin );
+    SerialType< uint64_t >::bout( detail::serial_hash< T, serial_coding >(), begin );
+
+    using IteratorType = typename SerialIteratorType::iterator;
+    auto serial_begin = SerialMetatype< T >::template iterator< serial_order, serial_coding >( IteratorType( begin ) );
+
+    detail::SharedScope scope;
     SerialType< T >::bout( value, serial_begin );
+    detail::bout_checksum< ByteArray >( SerialIteratorType( bytes.begin() + offset + header_size ), IteratorType( serial_begin ) );
+}
+
+/**
+ *
+ */
+template< typename ByteArray >
+SerialFrame< ByteArray > SerialBatch< ByteArray >::frame( std::size_t offset ) const {
+
+    using detail::SerialType;
+    using LengthType = typename FrameType::LengthType;
+
+    std::size_t available = m_bytes.size() - offset;
+    if ( FrameType::header_size + SerialType< uint64_t >::size() > available )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    using SerialIteratorType = detail::SerialIteratorConstAlias< ByteArray >;
+    SerialIteratorType begin( m_bytes.begin() + offset );
+
+    LengthType length;
+    uint8_t flags;
+    uint64_t hash;
+    begin.bin( length );
+    begin.bin( flags );
+
+    if ( length < SerialType< uint64_t >::size() || length > available - FrameType::header_size )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    const char* data = &*begin;
+    begin.bin( hash );
+
+    return FrameType( data, length, hash, flags );
+}
+
+/**
+ * Compressed frame keeps the hash header and the size of the decompressed message before the compressed block,
+ * the size is limited by the maximum ratio of the block format.
+ */
+template< typename ByteArray >
+typename SerialFrame< ByteArray >::ViewType SerialFrame< ByteArray >::bytes() const {
+
+    using detail::SerialType;
+
+    if ( !compressed() )
+        return ViewType( const_cast< char* >( m_data ), m_size );
+
+    constexpr std::size_t prefix = SerialType< uint64_t >::size() + SerialType< LengthType >::size();
+    if ( m_size < prefix )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    const ViewType frame( const_cast< char* >( m_data ), m_size );
+    detail::SerialIteratorConstAlias< ViewType > begin( frame.begin() + SerialType< uint64_t >::size() );
+
+    LengthType length;
+    begin.bin( length );
+
+    std::size_t packed = m_size - prefix;
+    if ( length > packed * 255 + detail::lz_match_limit )
+        throw SerialException( SerialException::ExcLayoutIncompatible );
+
+    std::string& scratch = detail::lz_scratch();
+    scratch.resize( SerialType< uint64_t >::size() + length );
+    std::memcpy( &scratch[ 0 ], m_data, SerialType< uint64_t >::size() );
+    detail::lz_decompress( m_data + prefix, packed, &scratch[ SerialType< uint64_t >::size() ], length );
+
+    return ViewType( &scratch[ 0 ], scratch.size() );
+}
+
+/**
+ *
+ */
+template< SerialEndian endian, typename T >
+void write( SerialSink& sink, const T& value ) {
+
+    using detail::SerialType;
+
+    constexpr auto serial_order = detail::endian_traits< endian >::internal_endian;
+    detail::SinkIterator< serial_order > begin{ sink };
+
+    SerialType< uint64_t >::bout( detail::serial_hash< T >(), begin );
+
+    detail::SharedScope scope;
+    SerialType< T >::bout( value, begin );
+    sink.flush();
 }
 
 /**
@@ -121,39 +367,154 @@ T parse( const ByteArray& bytes ) {
 /**
  *
  */
-template< typename T, typename ByteArray = std::string >
+template< typename T, typename ByteArray >
 void parse( T& value, const ByteArray& bytes ) {
 
-    if ( size< T >() > bytes.size() )
-        throw SerialException( SerialException::ExcBufferOverflow );
-
     using detail::SerialMetatype;
     using detail::SerialType;
-    using detail::SerialHash;
 
     using SerialIteratorType = detail::SerialIteratorConstAlias< ByteArray >;
+    using IteratorType = typename SerialIteratorType::iterator;
+    constexpr auto serial_order = SerialIteratorType::order;
+    constexpr auto serial_coding = detail::rebind_encoding< ByteArray >::internal_encoding;
+    using DataIteratorType = detail::SerialIterator< serial_order, IteratorType, serial_coding >;
+
+    constexpr auto trailer_size = detail::rebind_checksum< ByteArray >::trailer_size;
+    if ( SerialType< uint64_t >::size() + trailer_size > bytes.size() )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
     SerialIteratorType begin( bytes.begin() );
+    SerialIteratorType end( bytes.end() );
+    detail::bin_checksum< ByteArray >( begin, end );
 
     uint64_t hash;
-    SerialType< uint64_t >::bin( hash, begin );
+    SerialType< uint64_t >::bin( hash, begin, end );
 
-    if ( SerialMetatype< T >::alias().hash() != SerialHash( hash ).head() ) {
-        detail::MatchFunctor functor{ false, SerialType< T >::hash(), SerialHash( hash ).tail() };
-        if ( !search_serial( functor ) || !functor.match_result )
-            throw SerialException( SerialException::ExcLayoutIncompatible );
-    }
+    detail::check_hash< T, serial_coding >( hash );
 
-    else if ( SerialType< T >::hash() != SerialHash( hash ).tail() )
-        throw SerialException( SerialException::ExcBinaryIncompatible );
+    if ( DataIteratorType::least( SerialType< T >::size() ) > std::size_t( std::distance( begin, end ) ) )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    auto serial_begin = SerialMetatype< T >::template iterator< serial_order, serial_coding >( IteratorType( begin ) );
+    auto serial_end = SerialMetatype< T >::template iterator< serial_order, serial_coding >( IteratorType( end ) );
+
+    detail::SharedScope scope;
+    SerialType< T >::bin( value, serial_begin, serial_end );
+}
 
+/**
+ *
+ */
+template< typename T, typename ByteArray >
+void parse( T& value, const ByteArray& bytes, SerialExecutor& executor ) {
+
+    detail::ExecutorScope scope( &executor );
+    parse( value, bytes );
+}
+
+/**
+ *
+ */
+template< typename T, std::size_t ... Index, typename ByteArray >
+void parse_fields( T& value, const ByteArray& bytes ) {
+
+    using detail::SerialMetatype;
+    using detail::SerialType;
+
+    using SerialIteratorType = detail::SerialIteratorConstAlias< ByteArray >;
     using IteratorType = typename SerialIteratorType::iterator;
     constexpr auto serial_order = SerialIteratorType::order;
-    auto serial_begin_copy = SerialMetatype< T >::template iterator< serial_order >( IteratorType( begin ) );
-    auto serial_begin = SerialMetatype< T >::template iterator< serial_order >( IteratorType( begin ) );
-    auto serial_end = SerialMetatype< T >::template iterator< serial_order >( IteratorType( bytes.end() ) );
+    constexpr auto serial_coding = detail::rebind_encoding< ByteArray >::internal_encoding;
+    using DataIteratorType = detail::SerialIterator< serial_order, IteratorType, serial_coding >;
 
-    SerialType< T >::init( value, serial_begin, serial_end );
-    SerialType< T >::bin( value, serial_begin_copy );
+    constexpr auto trailer_size = detail::rebind_checksum< ByteArray >::trailer_size;
+    if ( SerialType< uint64_t >::size() + trailer_size > bytes.size() )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    SerialIteratorType begin( bytes.begin() );
+    SerialIteratorType end( bytes.end() );
+    detail::bin_checksum< ByteArray >( begin, end );
+
+    uint64_t hash;
+    SerialType< uint64_t >::bin( hash, begin, end );
+
+    detail::check_hash< T, serial_coding >( hash );
+
+    if ( DataIteratorType::least( SerialType< T >::size() ) > std::size_t( std::distance( begin, end ) ) )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    auto serial_begin = SerialMetatype< T >::template iterator< serial_order, serial_coding >( IteratorType( begin ) );
+    auto serial_end = SerialMetatype< T >::template iterator< serial_order, serial_coding >( IteratorType( end ) );
+
+    detail::SharedScope scope;
+    SerialType< T >::template bin_fields< Index... >( value, serial_begin, serial_end );
+}
+
+/**
+ *
+ */
+template< typename T, std::size_t ... Index, typename ByteArray >
+T parse_fields( const ByteArray& bytes ) {
+
+    T value{};
+    parse_fields< T, Index... >( value, bytes );
+    return value;
+}
+
+#if defined( SERIAL_MEMORY_RESOURCE )
+
+/**
+ *
+ */
+template< typename T, typename ByteArray >
+T parse( const ByteArray& bytes, std::pmr::memory_resource* resource ) {
+
+    detail::ResourceScope scope( resource );
+    T value;
+    parse( value, bytes );
+    return value;
+}
+
+/**
+ *
+ */
+template< typename T, typename ByteArray >
+void parse( T& value, const ByteArray& bytes, std::pmr::memory_resource* resource ) {
+
+    detail::ResourceScope scope( resource );
+    parse( value, bytes );
+}
+
+#endif
+
+/**
+ *
+ */
+template< typename T, typename ByteArray >
+auto view( const ByteArray& bytes ) {
+
+    static_assert( detail::rebind_encoding< ByteArray >::internal_encoding == FixedEncoding,
+        "view requires fixed encoding" );
+
+    using detail::SerialType;
+
+    if ( SerialType< uint64_t >::size() + detail::rebind_checksum< ByteArray >::trailer_size > bytes.size() )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    using SerialIteratorType = detail::SerialIteratorConstAlias< ByteArray >;
+    SerialIteratorType begin( bytes.begin() );
+    SerialIteratorType end( bytes.end() );
+    detail::bin_checksum< ByteArray >( begin, end );
+
+    uint64_t hash;
+    SerialType< uint64_t >::bin( hash, begin, end );
+
+    detail::check_hash< T >( hash );
+
+    if ( SerialType< T >::size() > std::size_t( std::distance( begin, end ) ) )
+        throw SerialException( SerialException::ExcBufferOverflow );
+
+    return detail::ViewType< T, SerialIteratorType >( begin, end );
 }
 
 /**
@@ -171,13 +532,33 @@ uint64_t size() {
 template< typename T >
 uint64_t size( const T& value ) {
 
+    detail::SharedScope scope;
     return detail::SerialType< uint64_t >::size() + detail::SerialType< T >::size( value );
 }
 
 /**
  *
  */
-template< typename ByteArray = std::string >
+template< typename T >
+constexpr bool fixed() {
+
+    return detail::SerialType< T >::fixed();
+}
+
+/**
+ *
+ */
+template< typename T >
+constexpr std::size_t fixed_size() {
+
+    static_assert( detail::SerialType< T >::fixed(), "type has no fixed size" );
+    return detail::SerialType< uint64_t >::size() + detail::SerialType< T >::size();
+}
+
+/**
+ *
+ */
+template< typename ByteArray >
 uint64_t hash( const ByteArray& bytes ) {
 
     if ( detail::SerialType< uint64_t >::size() > bytes.size() )
@@ -185,9 +566,10 @@ uint64_t hash( const ByteArray& bytes ) {
 
     using SerialIteratorType = detail::SerialIteratorConstAlias< ByteArray >;
     SerialIteratorType begin( bytes.begin() );
+    SerialIteratorType end( bytes.end() );
 
     uint64_t hash;
-    detail::SerialType< uint64_t >::bin( hash, begin );
+    detail::SerialType< uint64_t >::bin( hash, begin, end );
     return hash;
 }
 
@@ -205,9 +587,8 @@ uint64_t ident() {
  */
 uint64_t ident( const std::string& alias ) {
 
-    detail::HashFunctor functor{ uint64_t( -1 ), alias };
-    search_serial( functor );
-    return functor.hash;
+    auto entry = detail::serial_registry().find( alias );
+    return entry ? entry->hash : uint64_t( -1 );
 }
 
 /**
@@ -224,9 +605,8 @@ std::string alias() {
  */
 std::string alias( uint64_t ident ) {
 
-    detail::AliasFunctor functor{ {}, ident };
-    search_serial( functor );
-    return functor.alias;
+    auto entry = detail::serial_registry().find( ident );
+    return entry ? entry->alias : std::string();
 }
 
 } // --- namespace
@@ -239,7 +619,27 @@ template SerialWrapper< ByteArray, NativeEndian > serialize< SerialWrapper< Byte
 template void serialize< ByteArray, Type >( ByteArray&, const Type& ); \
 template void serialize< SerialWrapper< ByteArray, BigEndian >, Type >( SerialWrapper< ByteArray, BigEndian >&, const Type& ); \
 template void serialize< SerialWrapper< ByteArray, LittleEndian >, Type >( SerialWrapper< ByteArray, LittleEndian >&, const Type& ); \
-template void serialize< SerialWrapper< ByteArray, NativeEndian >, Type >( SerialWrapper< ByteArray, NativeEndian >&, const Type& );
+template void serialize< SerialWrapper< ByteArray, NativeEndian >, Type >( SerialWrapper< ByteArray, NativeEndian >&, const Type& ); \
+template void serialize_unchecked< ByteArray, Type >( ByteArray&, const Type& ); \
+template void serialize_unchecked< SerialWrapper< ByteArray, BigEndian >, Type >( SerialWrapper< ByteArray, BigEndian >&, const Type& ); \
+template void serialize_unchecked< SerialWrapper< ByteArray, LittleEndian >, Type >( SerialWrapper< ByteArray, LittleEndian >&, const Type& ); \
+template void serialize_unchecked< SerialWrapper< ByteArray, NativeEndian >, Type >( SerialWrapper< ByteArray, NativeEndian >&, const Type& );
+
+#define SERIAL_APPEND( Type, ByteArray ) \
+template void append< ByteArray, Type >( ByteArray&, const Type&, uint8_t ); \
+template void append< SerialWrapper< ByteArray, BigEndian >, Type >( SerialWrapper< ByteArray, BigEndian >&, const Type&, uint8_t ); \
+template void append< SerialWrapper< ByteArray, LittleEndian >, Type >( SerialWrapper< ByteArray, LittleEndian >&, const Type&, uint8_t ); \
+template void append< SerialWrapper< ByteArray, NativeEndian >, Type >( SerialWrapper< ByteArray, NativeEndian >&, const Type&, uint8_t );
+
+#define SERIAL_WRITE( Type ) \
+template void write< BigEndian, Type >( SerialSink&, const Type& ); \
+template void write< LittleEndian, Type >( SerialSink&, const Type& ); \
+template void write< NativeEndian, Type >( SerialSink&, const Type& );
+
+#define SERIAL_DECODE( Type ) \
+template class SerialDecoder< Type, BigEndian >; \
+template class SerialDecoder< Type, LittleEndian >; \
+template class SerialDecoder< Type, NativeEndian >;
 
 #define SERIAL_PARSE( Type, ByteArray ) \
 template Type parse< Type, ByteArray >( const ByteArray& ); \
@@ -251,6 +651,20 @@ template void parse< Type, SerialWrapper< ByteArray, BigEndian > >( Type&, const
 template void parse< Type, SerialWrapper< ByteArray, LittleEndian > >( Type&, const SerialWrapper< ByteArray, LittleEndian >& ); \
 template void parse< Type, SerialWrapper< ByteArray, NativeEndian > >( Type&, const SerialWrapper< ByteArray, NativeEndian >& );
 
+#if defined( SERIAL_MEMORY_RESOURCE )
+
+#define SERIAL_PARSE_RESOURCE( Type, ByteArray ) \
+template Type parse< Type, ByteArray >( const ByteArray&, std::pmr::memory_resource* ); \
+template Type parse< Type, SerialWrapper< ByteArray, BigEndian > >( const SerialWrapper< ByteArray, BigEndian >&, std::pmr::memory_resource* ); \
+template Type parse< Type, SerialWrapper< ByteArray, LittleEndian > >( const SerialWrapper< ByteArray, LittleEndian >&, std::pmr::memory_resource* ); \
+template Type parse< Type, SerialWrapper< ByteArray, NativeEndian > >( const SerialWrapper< ByteArray, NativeEndian >&, std::pmr::memory_resource* ); \
+template void parse< Type, ByteArray >( Type&, const ByteArray&, std::pmr::memory_resource* ); \
+template void parse< Type, SerialWrapper< ByteArray, BigEndian > >( Type&, const SerialWrapper< ByteArray, BigEndian >&, std::pmr::memory_resource* ); \
+template void parse< Type, SerialWrapper< ByteArray, LittleEndian > >( Type&, const SerialWrapper< ByteArray, LittleEndian >&, std::pmr::memory_resource* ); \
+template void parse< Type, SerialWrapper< ByteArray, NativeEndian > >( Type&, const SerialWrapper< ByteArray, NativeEndian >&, std::pmr::memory_resource* );
+
+#endif
+
 #define SERIAL_SIZE( Type ) \
 template uint64_t size< Type >(); \
 template uint64_t size< Type >( const Type& );
@@ -258,6 +672,12 @@ template uint64_t size< Type >( const Type& );
 #define SERIAL_HASH( ByteArray ) \
 template uint64_t hash< ByteArray >( const ByteArray& );
 
+#define SERIAL_BATCH( ByteArray ) \
+template class SerialBatch< ByteArray >; \
+template class SerialBatch< SerialWrapper< ByteArray, BigEndian > >; \
+template class SerialBatch< SerialWrapper< ByteArray, LittleEndian > >; \
+template class SerialBatch< SerialWrapper< ByteArray, NativeEndian > >;
+
 #define SERIAL_IDENT( Type ) \
 template uint64_t ident< Type >();
 
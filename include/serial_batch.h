@@ -0,0 +1,247 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <iterator>
+
+namespace memserial {
+namespace detail {
+
+template< typename ByteArray >
+struct rebind_frame {
+    using ViewType = SerialView;
+};
+
+template< typename ByteArray, SerialEndian endian, SerialEncoding encoding, SerialChecksum checksum >
+struct rebind_frame< SerialWrapper< ByteArray, endian, encoding, checksum > > {
+    using ViewType = SerialWrapper< SerialView, endian, encoding, checksum >;
+};
+
+} // --- namespace
+
+/**
+ * \~english
+ * \brief Frame flags reserved by the library.
+ * CompressedFrame marks the message compressed with the built-in LZ block compressor,
+ * the hash header stays uncompressed and is followed by the size of the decompressed message.
+ * \~russian
+ * \brief Флаги кадра, зарезервированные библиотекой.
+ * CompressedFrame отмечает сообщение, сжатое встроенным блочным компрессором LZ,
+ * заголовок с хешем остается несжатым, за ним следует размер распакованного сообщения.
+ */
+enum SerialFrameFlag : uint8_t {
+    CompressedFrame = 0x80
+};
+
+/**
+ * \~english
+ * \brief The frame of serialized data in a batch.
+ * The frame consists of a header with the message length and flags, followed by the message itself.
+ * \~russian
+ * \brief Кадр сериализованных данных в пакете.
+ * Кадр состоит из заголовка с длиной сообщения и флагами, за которым следует само сообщение.
+ */
+template< typename ByteArray = std::string >
+class SerialFrame {
+public:
+    using ViewType = typename detail::rebind_frame< ByteArray >::ViewType;
+    using LengthType = uint32_t;
+
+    static constexpr std::size_t header_size = sizeof( LengthType ) + sizeof( uint8_t );
+
+    SerialFrame() :
+            m_data( nullptr ),
+            m_size( 0 ),
+            m_hash( 0 ),
+            m_flags( 0 ) {
+    }
+
+    SerialFrame( const char* data, std::size_t size, uint64_t hash, uint8_t flags ) :
+            m_data( data ),
+            m_size( size ),
+            m_hash( hash ),
+            m_flags( flags ) {
+    }
+
+    /**
+     * \~english
+     * \brief Returns identifier of the message type without decoding the message.
+     * \~russian
+     * \brief Возвращает идентификатор типа сообщения без его декодирования.
+     */
+    uint64_t hash() const {
+        return m_hash;
+    }
+
+    /**
+     * \~english
+     * \brief Returns user flags of the frame.
+     * \~russian
+     * \brief Возвращает пользовательские флаги кадра.
+     */
+    uint8_t flags() const {
+        return m_flags;
+    }
+
+    /**
+     * \~english
+     * \brief Returns true if the message is compressed.
+     * \~russian
+     * \brief Возвращает true, если сообщение сжато.
+     */
+    bool compressed() const {
+        return ( m_flags & CompressedFrame ) != 0;
+    }
+
+    /**
+     * \~english
+     * \brief Returns size of the message as stored in the batch.
+     * \~russian
+     * \brief Возвращает размер сообщения в том виде, в котором оно хранится в пакете.
+     */
+    std::size_t size() const {
+        return m_size;
+    }
+
+    const char* data() const {
+        return m_data;
+    }
+
+    /**
+     * \~english
+     * \brief Returns the message as a byte array suitable for parse, view and trace methods.
+     * The array refers to the batch data and does not own it.
+     * A compressed message is decompressed into a scratch buffer of the calling thread,
+     * the array remains valid until the next decompression on the same thread.
+     * \throw SerialException In case of corrupted compressed message.
+     * \~russian
+     * \brief Возвращает сообщение в виде массива байт, пригодного для методов parse, view и trace.
+     * Массив ссылается на данные пакета и не владеет ими.
+     * Сжатое сообщение распаковывается в рабочий буфер вызывающего потока,
+     * массив остается действительным до следующей распаковки в том же потоке.
+     * \throw SerialException В случае поврежденного сжатого сообщения.
+     */
+    ViewType bytes() const;
+
+private:
+    const char* m_data;
+    std::size_t m_size;
+    uint64_t m_hash;
+    uint8_t m_flags;
+};
+
+/**
+ * \~english
+ * \brief The reader of framed messages stored in a single byte array.
+ * Frames are visited in order, messages are not decoded until requested.
+ * The batch refers to the byte array, so the array must outlive the batch and cannot be a temporary.
+ * \throw SerialException In case of truncated frame when advancing the iterator.
+ * \~russian
+ * \brief Класс чтения кадрированных сообщений, хранящихся в одном массиве байт.
+ * Кадры обходятся по порядку, сообщения не декодируются до запроса.
+ * Пакет ссылается на массив байт, поэтому массив должен существовать дольше пакета и не может быть временным.
+ * \throw SerialException В случае усеченного кадра при продвижении итератора.
+ */
+template< typename ByteArray = std::string >
+class SerialBatch {
+public:
+    using FrameType = SerialFrame< ByteArray >;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FrameType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const FrameType*;
+        using reference = const FrameType&;
+
+        iterator( const SerialBatch* batch, std::size_t offset ) :
+                m_batch( batch ),
+                m_offset( offset ) {
+            if ( m_offset != m_batch->size() )
+                m_frame = m_batch->frame( m_offset );
+        }
+
+        reference operator*() const {
+            return m_frame;
+        }
+
+        pointer operator->() const {
+            return &m_frame;
+        }
+
+        iterator& operator++() {
+            m_offset += FrameType::header_size + m_frame.size();
+            if ( m_offset != m_batch->size() )
+                m_frame = m_batch->frame( m_offset );
+            return *this;
+        }
+
+        iterator operator++( int ) {
+            iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==( const iterator& other ) const {
+            return m_offset == other.m_offset;
+        }
+
+        bool operator!=( const iterator& other ) const {
+            return m_offset != other.m_offset;
+        }
+
+    private:
+        const SerialBatch* m_batch;
+        std::size_t m_offset;
+        FrameType m_frame;
+    };
+
+    using const_iterator = iterator;
+
+    explicit SerialBatch( const ByteArray& bytes ) :
+            m_bytes( bytes ) {
+    }
+
+    SerialBatch( ByteArray&& bytes ) = delete;
+
+    iterator begin() const {
+        return iterator( this, 0 );
+    }
+
+    iterator end() const {
+        return iterator( this, size() );
+    }
+
+    std::size_t size() const {
+        return m_bytes.size();
+    }
+
+    /**
+     * \~english
+     * \brief Returns the frame at the given offset.
+     * \throw SerialException In case of truncated frame.
+     * \~russian
+     * \brief Возвращает кадр по заданному смещению.
+     * \throw SerialException В случае усеченного кадра.
+     */
+    FrameType frame( std::size_t offset ) const;
+
+private:
+    const ByteArray& m_bytes;
+};
+
+} // --- namespace
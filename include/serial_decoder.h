@@ -0,0 +1,108 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace memserial {
+namespace detail {
+struct ScanProgram;
+}
+
+/**
+ * \~english
+ * \brief The incremental decoder of serialized data received in parts.
+ * Every received byte is scanned once, the structure is built in a single pass when the data is complete.
+ * Messages must be serialized from the type itself in fixed encoding without checksum trailer.
+ * \~russian
+ * \brief Инкрементальный декодер сериализованных данных, получаемых по частям.
+ * Каждый полученный байт просматривается один раз, структура строится за один проход после получения всех данных.
+ * Сообщения должны быть сериализованы из самого типа в фиксированной кодировке без контрольной суммы.
+ */
+template< typename T, SerialEndian endian = DefaultEndian >
+class SerialDecoder {
+public:
+    SerialDecoder();
+
+    /**
+     * \~english
+     * \brief Appends the next part of serialized data.
+     * \param data Pointer to the data.
+     * \param size Size of the data.
+     * \return Number of accepted bytes, the rest belongs to the next message.
+     * \throw SerialException In case of data structure mismatch, including messages of other types compatible with the type.
+     * \~russian
+     * \brief Добавляет очередную часть сериализованных данных.
+     * \param data Указатель на данные.
+     * \param size Размер данных.
+     * \return Количество принятых байт, остаток относится к следующему сообщению.
+     * \throw SerialException В случае несоответствия структуры данных, включая сообщения других типов, совместимых с типом.
+     */
+    std::size_t feed( const char* data, std::size_t size );
+
+    /**
+     * \~english
+     * \brief Returns the least number of bytes required to continue, zero if the data is complete.
+     * \~russian
+     * \brief Возвращает наименьшее количество байт, необходимое для продолжения, ноль если данные получены полностью.
+     */
+    std::size_t need() const;
+
+    /**
+     * \~english
+     * \brief Checks whether the data is complete.
+     * \~russian
+     * \brief Проверяет, получены ли данные полностью.
+     */
+    bool done() const;
+
+    /**
+     * \~english
+     * \brief Returns the structured data and resets the decoder for the next message.
+     * \throw SerialException In case of incomplete data.
+     * \~russian
+     * \brief Возвращает структуру данных и сбрасывает декодер для следующего сообщения.
+     * \throw SerialException В случае неполных данных.
+     */
+    T get();
+
+    void get( T& value );
+
+    /**
+     * \~english
+     * \brief Discards received data.
+     * \~russian
+     * \brief Отбрасывает полученные данные.
+     */
+    void reset();
+
+private:
+    struct Frame {
+        const detail::ScanProgram* program;
+        std::size_t index;
+        std::size_t count;
+    };
+
+    void advance();
+    bool reserve( std::size_t size );
+
+    std::string m_bytes;
+    std::vector< Frame > m_stack;
+    std::size_t m_offset;
+    std::size_t m_need;
+};
+
+} // --- namespace
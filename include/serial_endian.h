@@ -39,20 +39,61 @@ enum SerialEndian {
     DefaultEndian = SERIAL_ENDIAN_DEFAULT
 };
 
+/**
+ * \~english
+ * \brief Declaration of data encoding.
+ * FixedEncoding writes integers and array lengths at full width.
+ * CompactEncoding writes integers wider than a byte and array lengths as LEB128 varints,
+ * signed integers are zigzag encoded, other data is written as is.
+ * \~russian
+ * \brief Объявление кодирования данных.
+ * FixedEncoding записывает целые числа и длины массивов полной ширины.
+ * CompactEncoding записывает целые числа шире байта и длины массивов в виде LEB128 varint,
+ * знаковые целые числа предварительно кодируются zigzag, остальные данные записываются как есть.
+ */
+enum SerialEncoding {
+    FixedEncoding,
+    CompactEncoding
+};
+
+/**
+ * \~english
+ * \brief Declaration of data integrity check.
+ * Crc32cChecksum appends CRC32C of the hash header and data as a 4-byte trailer, it is verified before parsing.
+ * \~russian
+ * \brief Объявление проверки целостности данных.
+ * Crc32cChecksum добавляет CRC32C заголовка с хешем и данных в виде 4-байтового окончания, оно проверяется перед разбором.
+ */
+enum SerialChecksum {
+    NoChecksum,
+    Crc32cChecksum
+};
+
 /**
  * \~english
  * \brief The helper class used in serialization methods.
  * \~russian
  * \brief Вспомогательный класс, используемый в методах сериализации.
  */
-template< typename ByteArray, SerialEndian endian = DefaultEndian >
+template< typename ByteArray, SerialEndian endian = DefaultEndian, SerialEncoding encoding = FixedEncoding,
+        SerialChecksum checksum = NoChecksum >
 class SerialWrapper : public ByteArray {
 public:
+    using ByteArray::ByteArray;
+
     using type = ByteArray;
     static constexpr SerialEndian order = endian;
+    static constexpr SerialEncoding coding = encoding;
+    static constexpr SerialChecksum check = checksum;
 };
 
 template< SerialEndian endian = DefaultEndian >
 using StringWrapper = SerialWrapper< std::string, endian >;
 
+template< SerialEndian endian = DefaultEndian >
+using CompactWrapper = SerialWrapper< std::string, endian, CompactEncoding >;
+
+template< SerialEndian endian = DefaultEndian, SerialEncoding encoding = FixedEncoding >
+using CheckedWrapper = SerialWrapper< std::string, endian, encoding, Crc32cChecksum >;
+
 } // --- namespace
@@ -30,7 +30,10 @@ public:
         ExcArrayOverflow,
         ExcBufferOverflow,
         ExcLayoutIncompatible,
-        ExcBinaryIncompatible
+        ExcBinaryIncompatible,
+        ExcEncodingIncompatible,
+        ExcChecksumMismatch,
+        ExcHashCollision
     };
 
     SerialException( ExceptionCode code ) :
@@ -45,13 +48,19 @@ public:
     const char* what() const noexcept override {
         switch ( m_code ) {
         case ExcArrayOverflow:
-            return "dynamic array size must be less than 2^32";
+            return "dynamic array size exceeds the range of its size prefix";
         case ExcBufferOverflow:
             return "data size of serialized buffer is too small to fit the type";
         case ExcLayoutIncompatible:
             return "data structure of serialized buffer does not match the type";
         case ExcBinaryIncompatible:
             return "data type of serialized buffer is binary incompatible with the original type";
+        case ExcEncodingIncompatible:
+            return "data encoding of serialized buffer does not match the requested encoding";
+        case ExcChecksumMismatch:
+            return "checksum of serialized buffer does not match its data";
+        case ExcHashCollision:
+            return "hash of registered type collides with another registered type";
         default:
             return "unknown exception case";
         }
@@ -0,0 +1,95 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace memserial {
+
+/**
+ * \internal
+ * Least number of elements of an array of classes serialized in parallel, default is 4096.
+ */
+#if !defined( SERIAL_PARALLEL_THRESHOLD )
+#define SERIAL_PARALLEL_THRESHOLD 4096
+#endif
+
+/**
+ * \~english
+ * \brief The base class of executors used in parallel serialization methods.
+ * The run() method calls the task for every index from zero to count and returns when all calls are finished,
+ * tasks passed by the library do not throw.
+ * \~russian
+ * \brief Базовый класс исполнителей, используемых в методах параллельной сериализации.
+ * Метод run() вызывает задачу для каждого индекса от нуля до count и возвращает управление по завершении всех вызовов,
+ * задачи, передаваемые библиотекой, не выбрасывают исключений.
+ */
+class SerialExecutor {
+public:
+    using TaskType = std::function< void( std::size_t ) >;
+
+    virtual ~SerialExecutor() = default;
+
+    virtual std::size_t concurrency() const = 0;
+
+    virtual void run( std::size_t count, const TaskType& task ) = 0;
+};
+
+/**
+ * \~english
+ * \brief The executor running tasks on threads started for each call, including the calling thread.
+ * \~russian
+ * \brief Исполнитель, выполняющий задачи в потоках, запускаемых на каждый вызов, включая вызывающий поток.
+ */
+class SerialThreadExecutor : public SerialExecutor {
+public:
+    explicit SerialThreadExecutor( std::size_t threads = std::thread::hardware_concurrency() ) :
+            m_threads( threads == 0 ? 1 : threads ) {
+    }
+
+    std::size_t concurrency() const override {
+        return m_threads;
+    }
+
+    void run( std::size_t count, const TaskType& task ) override {
+        std::atomic< std::size_t > next( 0 );
+        auto worker = [ & ]() {
+            for ( std::size_t index = next++; index < count; index = next++ )
+                task( index );
+        };
+
+        std::vector< std::thread > threads;
+        try {
+            for ( std::size_t index = 1; index < m_threads && index < count; ++index )
+                threads.emplace_back( worker );
+        }
+        catch ( const std::system_error& ) {
+        }
+
+        worker();
+        for ( auto& thread : threads )
+            thread.join();
+    }
+
+private:
+    std::size_t m_threads;
+};
+
+} // --- namespace
@@ -20,6 +20,12 @@
 #include <cstring>
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <memory>
 #include <tuple>
 #include <array>
 #include <bitset>
@@ -28,8 +34,19 @@
 #include <complex>
 #include <type_traits>
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 
+#if __cplusplus >= 201703L
+#include <string_view>
+#include <optional>
+#include <variant>
+#if __has_include( <memory_resource> )
+#include <memory_resource>
+#define SERIAL_MEMORY_RESOURCE
+#endif
+#endif
+
 #define PACK( ... ) __VA_ARGS__
 #define UNPACK( ... ) #__VA_ARGS__
 
@@ -51,25 +68,59 @@
 #define SERIAL_HASH_SALT 0xffffffff
 #endif
 
+/**
+ * \internal
+ * The value mixed into the layout hash of data in compact encoding.
+ * Allows to distinguish data encodings on reading.
+ */
+#if !defined( SERIAL_COMPACT_SALT )
+#define SERIAL_COMPACT_SALT 0x9e3779b9
+#endif
+
+/**
+ * \internal
+ * The default type of length prefix of strings and vectors, default is uint32_t.
+ * May be uint8_t, uint16_t, uint32_t or uint64_t, the width is a part of the layout hash.
+ */
+#if !defined( SERIAL_SIZE_TYPE )
+#define SERIAL_SIZE_TYPE uint32_t
+#endif
+
 #include "serial_view.h"
+#include "serial_sink.h"
+#include "serial_executor.h"
+#include "serial_mapping.h"
 #include "serial_endian.h"
 #include "serial_exception.h"
 #include "detail/serial_intrinsic.h"
 #include "detail/serial_traits.h"
+#include "detail/serial_varint.h"
+#include "detail/serial_lz.h"
 #include "detail/serial_iterator.h"
 #include "detail/serial_metatype.h"
+#include "detail/serial_scan.h"
+#include "detail/serial_resource.h"
+#include "detail/serial_shared.h"
+#include "detail/serial_parallel.h"
 #include "detail/serial_nulltype.h"
 #include "detail/serial_primitive.h"
 #include "detail/serial_aggregate.h"
 #include "detail/serial_string.h"
 #include "detail/serial_vector.h"
 #include "detail/serial_tuple.h"
+#include "detail/serial_pair.h"
 #include "detail/serial_array.h"
 #include "detail/serial_bitset.h"
 #include "detail/serial_timepoint.h"
 #include "detail/serial_duration.h"
 #include "detail/serial_complex.h"
+#include "detail/serial_optional.h"
+#include "detail/serial_variant.h"
+#include "detail/serial_associative.h"
+#include "detail/serial_pointer.h"
 #include "detail/serial_ident.h"
+#include "detail/serial_registry.h"
+#include "detail/serial_access.h"
 
 /**
  * \internal
@@ -77,7 +128,10 @@
  */
 #if !defined( DISABLE_SERIALIZATION )
 #include "serialization.h"
+#include "serial_decoder.h"
+#include "serial_batch.h"
 #include "detail/serialization_impl.h"
+#include "detail/serial_decoder_impl.h"
 #endif
 
 /**
@@ -127,6 +181,49 @@
 SERIAL_TYPE( PACK( Type ) ) \
 SERIAL_INFO( PACK( Type ) )
 
+/**
+ * \internal
+ * Macro declares the type of length prefix for the string or vector type, which overrides SERIAL_SIZE_TYPE.
+ * Must be declared before the first use of the type.
+ */
+#define SERIAL_LENGTH_TYPE( Type, LengthType ) \
+namespace memserial { \
+namespace detail { \
+template<> \
+struct rebind_size< Type > { \
+    using SizeType = LengthType; \
+}; \
+}}
+
+/**
+ * \internal
+ * Macro declares the offset index for the vector type of variable size elements.
+ * Vectors longer than Chunk elements are written with offsets of every Chunk elements before the elements,
+ * which allows to decode chunks in parallel and to access elements of a view without decoding preceding chunks.
+ * Must be declared before the first use of the type.
+ */
+#define SERIAL_INDEX_TYPE( Type, Chunk ) \
+namespace memserial { \
+namespace detail { \
+template<> \
+struct rebind_index< Type > { \
+    static constexpr std::size_t chunk = Chunk; \
+}; \
+}}
+
+/**
+ * \internal
+ * Macro declares the unordered container type to be written in the order of keys,
+ * so equal containers are written to equal bytes regardless of their history.
+ * Must be declared before the first use of the type.
+ */
+#define SERIAL_CANONICAL_TYPE( Type ) \
+namespace memserial { \
+namespace detail { \
+template<> \
+struct rebind_canonical< Type > : std::true_type {}; \
+}}
+
 #if defined( QT_CORE_LIB )
 #include <QByteArray>
 #include <QDebug>
@@ -139,6 +236,13 @@ SERIALIALIZE( PACK( Type ), QByteArray ) \
 SERIAL_PARSE( PACK( Type ), std::string ) \
 SERIAL_PARSE( PACK( Type ), SerialView ) \
 SERIAL_PARSE( PACK( Type ), QByteArray ) \
+SERIAL_PARSE_RESOURCE( PACK( Type ), std::string ) \
+SERIAL_PARSE_RESOURCE( PACK( Type ), SerialView ) \
+SERIAL_PARSE_RESOURCE( PACK( Type ), QByteArray ) \
+SERIAL_APPEND( PACK( Type ), std::string ) \
+SERIAL_APPEND( PACK( Type ), QByteArray ) \
+SERIAL_WRITE( PACK( Type ) ) \
+SERIAL_DECODE( PACK( Type ) ) \
 SERIAL_PRINT( PACK( Type ), std::ostream ) \
 SERIAL_PRINT( PACK( Type ), QDebug ) \
 SERIAL_SIZE( PACK( Type ) ) \
@@ -152,6 +256,9 @@ namespace memserial { \
 SERIAL_HASH( std::string ) \
 SERIAL_HASH( SerialView ) \
 SERIAL_HASH( QByteArray ) \
+SERIAL_BATCH( std::string ) \
+SERIAL_BATCH( SerialView ) \
+SERIAL_BATCH( QByteArray ) \
 SERIAL_TRACE( std::string, std::ostream ) \
 SERIAL_TRACE( SerialView, std::ostream ) \
 SERIAL_TRACE( QByteArray, QDebug ) \
@@ -169,6 +276,11 @@ SERIALIALIZE( PACK( Type ), std::string ) \
 SERIALIALIZE( PACK( Type ), SerialView ) \
 SERIAL_PARSE( PACK( Type ), std::string ) \
 SERIAL_PARSE( PACK( Type ), SerialView ) \
+SERIAL_PARSE_RESOURCE( PACK( Type ), std::string ) \
+SERIAL_PARSE_RESOURCE( PACK( Type ), SerialView ) \
+SERIAL_APPEND( PACK( Type ), std::string ) \
+SERIAL_WRITE( PACK( Type ) ) \
+SERIAL_DECODE( PACK( Type ) ) \
 SERIAL_PRINT( PACK( Type ), std::ostream ) \
 SERIAL_SIZE( PACK( Type ) ) \
 SERIAL_IDENT( PACK( Type ) ) \
@@ -180,6 +292,8 @@ SERIAL_VERSION( PACK( Type ) ) \
 namespace memserial { \
 SERIAL_HASH( std::string ) \
 SERIAL_HASH( SerialView ) \
+SERIAL_BATCH( std::string ) \
+SERIAL_BATCH( SerialView ) \
 SERIAL_TRACE( std::string, std::ostream ) \
 SERIAL_TRACE( SerialView, std::ostream ) \
 }
@@ -194,6 +308,22 @@ SERIAL_TRACE( SerialView, std::ostream ) \
 #define SERIAL_PARSE( Type, ByteArray )
 #endif
 
+#if !defined( SERIAL_PARSE_RESOURCE )
+#define SERIAL_PARSE_RESOURCE( Type, ByteArray )
+#endif
+
+#if !defined( SERIAL_APPEND )
+#define SERIAL_APPEND( Type, ByteArray )
+#endif
+
+#if !defined( SERIAL_WRITE )
+#define SERIAL_WRITE( Type )
+#endif
+
+#if !defined( SERIAL_DECODE )
+#define SERIAL_DECODE( Type )
+#endif
+
 #if !defined( SERIAL_SIZE )
 #define SERIAL_SIZE( Type )
 #endif
@@ -202,6 +332,10 @@ SERIAL_TRACE( SerialView, std::ostream ) \
 #define SERIAL_HASH( ByteArray )
 #endif
 
+#if !defined( SERIAL_BATCH )
+#define SERIAL_BATCH( ByteArray )
+#endif
+
 #if !defined( SERIAL_IDENT )
 #define SERIAL_IDENT( Type )
 #endif
@@ -0,0 +1,187 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+#include <string>
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace memserial {
+
+/**
+ * \~english
+ * \brief Declaration of expected access pattern to the mapped file.
+ * \~russian
+ * \brief Объявление ожидаемого порядка доступа к отображенному файлу.
+ */
+enum SerialAdvice {
+    NormalAccess = MADV_NORMAL,
+    SequentialAccess = MADV_SEQUENTIAL,
+    RandomAccess = MADV_RANDOM,
+    WillNeedAccess = MADV_WILLNEED,
+    DontNeedAccess = MADV_DONTNEED
+};
+
+/**
+ * \~english
+ * \brief The read-only file mapped into memory.
+ * Provides byte arrays referring to the mapped pages, which are suitable for parse, view, hash and trace methods
+ * without intermediate copies. Pages are loaded on demand, so files may exceed physical memory.
+ * \throw std::system_error In case of file open or mapping error.
+ * \~russian
+ * \brief Файл, отображенный в память только для чтения.
+ * Предоставляет массивы байт, ссылающиеся на отображенные страницы и пригодные для методов parse, view, hash и trace
+ * без промежуточных копий. Страницы загружаются по требованию, поэтому файлы могут превышать объем физической памяти.
+ * \throw std::system_error В случае ошибки открытия или отображения файла.
+ */
+class SerialMapping {
+public:
+    SerialMapping() :
+            m_data( nullptr ),
+            m_size( 0 ) {
+    }
+
+    explicit SerialMapping( const std::string& path, SerialAdvice advice = SequentialAccess ) :
+            SerialMapping() {
+        open( path, advice );
+    }
+
+    SerialMapping( const SerialMapping& ) = delete;
+    SerialMapping& operator=( const SerialMapping& ) = delete;
+
+    SerialMapping( SerialMapping&& other ) :
+            m_data( other.m_data ),
+            m_size( other.m_size ) {
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+
+    SerialMapping& operator=( SerialMapping&& other ) {
+        if ( this != &other ) {
+            close();
+            m_data = other.m_data;
+            m_size = other.m_size;
+            other.m_data = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    ~SerialMapping() {
+        close();
+    }
+
+    void open( const std::string& path, SerialAdvice advice = SequentialAccess ) {
+        close();
+
+        int descriptor = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+        if ( descriptor < 0 )
+            throw std::system_error( errno, std::generic_category() );
+
+        struct stat status;
+        if ( ::fstat( descriptor, &status ) < 0 ) {
+            int error = errno;
+            ::close( descriptor );
+            throw std::system_error( error, std::generic_category() );
+        }
+
+        std::size_t size = std::size_t( status.st_size );
+        if ( size != 0 ) {
+            void* data = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+            if ( data == MAP_FAILED ) {
+                int error = errno;
+                ::close( descriptor );
+                throw std::system_error( error, std::generic_category() );
+            }
+            m_data = static_cast< char* >( data );
+            m_size = size;
+        }
+
+        ::close( descriptor );
+        advise( advice );
+    }
+
+    void close() {
+        if ( m_data )
+            ::munmap( m_data, m_size );
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    /**
+     * \~english
+     * \brief Declares expected access pattern to the given range of the file, the range is aligned to pages.
+     * \~russian
+     * \brief Объявляет ожидаемый порядок доступа к заданному диапазону файла, диапазон выравнивается по страницам.
+     */
+    void advise( SerialAdvice advice, std::size_t offset = 0, std::size_t size = std::size_t( -1 ) ) const {
+        if ( !m_data || offset >= m_size )
+            return;
+
+        std::size_t page = std::size_t( ::sysconf( _SC_PAGESIZE ) );
+        std::size_t begin = offset / page * page;
+        std::size_t end = size < m_size - offset ? offset + size : m_size;
+        ::madvise( m_data + begin, end - begin, int( advice ) );
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    std::size_t size() const {
+        return m_size;
+    }
+
+    const char* data() const {
+        return m_data;
+    }
+
+    /**
+     * \~english
+     * \brief Returns the byte array referring to the given range of the file.
+     * The array must not outlive the mapping. Framed messages are read by a batch over the array held in a variable:
+     * \code
+     * SerialView bytes = mapping.view();
+     * for ( const auto& frame : SerialBatch< SerialView >( bytes ) )
+     *     parse< Type >( frame.bytes() );
+     * \endcode
+     * \~russian
+     * \brief Возвращает массив байт, ссылающийся на заданный диапазон файла.
+     * Массив не должен использоваться после закрытия отображения. Кадрированные сообщения читаются пакетом
+     * над массивом, сохраненным в переменной, как показано выше.
+     */
+    SerialView view( std::size_t offset = 0, std::size_t size = std::size_t( -1 ) ) const {
+        if ( offset > m_size )
+            offset = m_size;
+        if ( size > m_size - offset )
+            size = m_size - offset;
+        return SerialView( m_data + offset, size );
+    }
+
+private:
+    char* m_data;
+    std::size_t m_size;
+};
+
+} // --- namespace
+
+#endif
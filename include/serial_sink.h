@@ -0,0 +1,188 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstring>
+#include <cerrno>
+#include <functional>
+#include <ostream>
+#include <system_error>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <unistd.h>
+#endif
+
+namespace memserial {
+
+/**
+ * \internal
+ * Default capacity of the staging buffer used by serialization sinks, 64 KiB.
+ */
+#if !defined( SERIAL_SINK_CAPACITY )
+#define SERIAL_SINK_CAPACITY 65536
+#endif
+
+/**
+ * \~english
+ * \brief The base class of output sinks used in streaming serialization methods.
+ * Data is accumulated in a fixed-size staging buffer and passed to commit() in chunks,
+ * writes larger than the buffer bypass it.
+ * \~russian
+ * \brief Базовый класс приемников вывода, используемых в потоковых методах сериализации.
+ * Данные накапливаются в промежуточном буфере фиксированного размера и передаются в commit() частями,
+ * записи, превышающие размер буфера, передаются напрямую.
+ */
+class SerialSink {
+public:
+    explicit SerialSink( std::size_t capacity = SERIAL_SINK_CAPACITY ) :
+            m_data( new char[ capacity < 64 ? 64 : capacity ] ),
+            m_size( 0 ),
+            m_capacity( capacity < 64 ? 64 : capacity ) {
+    }
+
+    SerialSink( const SerialSink& ) = delete;
+    SerialSink& operator=( const SerialSink& ) = delete;
+
+    virtual ~SerialSink() {
+        delete[] m_data;
+    }
+
+    void write( const char* data, std::size_t size ) {
+        if ( size >= m_capacity ) {
+            flush();
+            commit( data, size );
+            return;
+        }
+        if ( m_capacity - m_size < size )
+            flush();
+        std::memcpy( m_data + m_size, data, size );
+        m_size += size;
+    }
+
+    char* acquire( std::size_t size ) {
+        if ( m_capacity - m_size < size )
+            flush();
+        return m_data + m_size;
+    }
+
+    void advance( std::size_t size ) {
+        m_size += size;
+    }
+
+    std::size_t available() const {
+        return m_capacity - m_size;
+    }
+
+    void flush() {
+        if ( m_size == 0 )
+            return;
+        std::size_t size = m_size;
+        m_size = 0;
+        commit( m_data, size );
+    }
+
+protected:
+    virtual void commit( const char* data, std::size_t size ) = 0;
+
+private:
+    char* m_data;
+    std::size_t m_size;
+    std::size_t m_capacity;
+};
+
+/**
+ * \~english
+ * \brief The sink passing serialized data to a user function.
+ * \~russian
+ * \brief Приемник, передающий сериализованные данные в пользовательскую функцию.
+ */
+class SerialCallbackSink : public SerialSink {
+public:
+    using CallbackType = std::function< void( const char*, std::size_t ) >;
+
+    explicit SerialCallbackSink( CallbackType callback, std::size_t capacity = SERIAL_SINK_CAPACITY ) :
+            SerialSink( capacity ),
+            m_callback( std::move( callback ) ) {
+    }
+
+protected:
+    void commit( const char* data, std::size_t size ) override {
+        m_callback( data, size );
+    }
+
+private:
+    CallbackType m_callback;
+};
+
+/**
+ * \~english
+ * \brief The sink writing serialized data to a standard output stream.
+ * \~russian
+ * \brief Приемник, записывающий сериализованные данные в стандартный поток вывода.
+ */
+class SerialStreamSink : public SerialSink {
+public:
+    explicit SerialStreamSink( std::ostream& stream, std::size_t capacity = SERIAL_SINK_CAPACITY ) :
+            SerialSink( capacity ),
+            m_stream( stream ) {
+    }
+
+protected:
+    void commit( const char* data, std::size_t size ) override {
+        m_stream.write( data, std::streamsize( size ) );
+    }
+
+private:
+    std::ostream& m_stream;
+};
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+/**
+ * \~english
+ * \brief The sink writing serialized data to a file descriptor.
+ * \throw std::system_error In case of write error.
+ * \~russian
+ * \brief Приемник, записывающий сериализованные данные в файловый дескриптор.
+ * \throw std::system_error В случае ошибки записи.
+ */
+class SerialFileSink : public SerialSink {
+public:
+    explicit SerialFileSink( int descriptor, std::size_t capacity = SERIAL_SINK_CAPACITY ) :
+            SerialSink( capacity ),
+            m_descriptor( descriptor ) {
+    }
+
+protected:
+    void commit( const char* data, std::size_t size ) override {
+        while ( size > 0 ) {
+            ssize_t count = ::write( m_descriptor, data, size );
+            if ( count < 0 ) {
+                if ( errno == EINTR )
+                    continue;
+                throw std::system_error( errno, std::generic_category() );
+            }
+            data += count;
+            size -= std::size_t( count );
+        }
+    }
+
+private:
+    int m_descriptor;
+};
+
+#endif
+
+} // --- namespace
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string>
+#include <array>
 
 namespace memserial {
 
@@ -34,16 +35,119 @@ ByteArray serialize( const T& value );
 /**
  * \~english
  * \brief Returns structured data in serialized form.
- * \param bytes Reference to byte array.
+ * \param bytes Reference to byte array, the array with checksum must have exactly the serialized size.
  * \param value Data structure.
+ * \throw SerialException In case of byte array size mismatch.
  * \~russian
  * \brief Возвращает структуру данных в сериализованном виде.
- * \param bytes Ссылка на массив байт.
+ * \param bytes Ссылка на массив байт, массив с контрольной суммой должен иметь точно размер сериализованных данных.
  * \param value Структура данных.
+ * \throw SerialException В случае несоответствия размера массива байт.
  */
 template< typename ByteArray = std::string, typename T >
 void serialize( ByteArray& bytes, const T& value );
 
+/**
+ * \~english
+ * \brief Returns structured data in serialized form without checking the byte array size.
+ * \param bytes Reference to byte array, its size must be at least size( value ),
+ * the array with checksum must have exactly the size of the data and the checksum trailer.
+ * \param value Data structure.
+ * \~russian
+ * \brief Возвращает структуру данных в сериализованном виде без проверки размера массива байт.
+ * \param bytes Ссылка на массив байт, размер которого не меньше size( value ),
+ * массив с контрольной суммой должен иметь точно размер данных и окончания с контрольной суммой.
+ * \param value Структура данных.
+ */
+template< typename ByteArray = std::string, typename T >
+void serialize_unchecked( ByteArray& bytes, const T& value );
+
+/**
+ * \~english
+ * \brief Returns structured data of fixed size type in serialized form without memory allocation.
+ * The buffer size is checked at compile time, std::array buffers of other types or of smaller size
+ * are serialized by the overload that checks the size at run time.
+ * \param bytes Reference to buffer, its size must be at least fixed_size< T >().
+ * \param value Data structure.
+ * \~russian
+ * \brief Возвращает структуру данных типа фиксированного размера в сериализованном виде без выделения памяти.
+ * Размер буфера проверяется на этапе компиляции, буферы std::array других типов или меньшего размера
+ * сериализуются перегрузкой с проверкой размера во время выполнения.
+ * \param bytes Ссылка на буфер, размер которого не меньше fixed_size< T >().
+ * \param value Структура данных.
+ */
+template< typename T, std::size_t N, typename = std::enable_if_t< detail::serial_fixed_fits< T, N >() > >
+void serialize( std::array< char, N >& bytes, const T& value );
+
+template< typename T, std::size_t N, SerialEndian endian, typename = std::enable_if_t< detail::serial_fixed_fits< T, N >() > >
+void serialize( SerialWrapper< std::array< char, N >, endian >& bytes, const T& value );
+
+template< typename T, std::size_t N >
+void serialize( char ( &bytes )[ N ], const T& value );
+
+/**
+ * \~english
+ * \brief Returns structured data in serialized form, large arrays of classes are sized and written in parallel.
+ * Arrays are split into slices, offsets of slices are computed from their sizes and the slices are written in place,
+ * so the output is identical to the sequential one, slice sizes computed while sizing are reused while writing.
+ * \param bytes Reference to byte array, its size must be at least size( value ),
+ * the array with checksum must have exactly the size of serialized data.
+ * \param value Data structure.
+ * \param executor Executor of parallel tasks.
+ * \throw SerialException In case of byte array size mismatch or dynamic array overflow.
+ * \~russian
+ * \brief Возвращает структуру данных в сериализованном виде, размер и запись больших массивов классов выполняются параллельно.
+ * Массивы разбиваются на части, смещения частей вычисляются по их размерам и части записываются на место,
+ * поэтому вывод идентичен последовательному, размеры частей, вычисленные при подсчёте размера, используются при записи.
+ * \param bytes Ссылка на массив байт, размер которого не меньше size( value ),
+ * массив с контрольной суммой должен иметь точно размер сериализованных данных.
+ * \param value Структура данных.
+ * \param executor Исполнитель параллельных задач.
+ * \throw SerialException В случае несоответствия размера массива байт или переполнения динамического массива.
+ */
+template< typename ByteArray = std::string, typename T >
+void serialize( ByteArray& bytes, const T& value, SerialExecutor& executor );
+
+/**
+ * \~english
+ * \brief Appends structured data in serialized form as a frame to the end of the byte array.
+ * Frames are read with the SerialBatch class.
+ * The CompressedFrame flag compresses the message, it is serialized into a reusable window of the calling thread
+ * and compressed from there directly into the byte array.
+ * \param bytes Reference to byte array.
+ * \param value Data structure.
+ * \param flags User flags of the frame.
+ * \throw SerialException In case of dynamic array or frame length overflow.
+ * \~russian
+ * \brief Добавляет структуру данных в сериализованном виде в качестве кадра в конец массива байт.
+ * Кадры читаются с помощью класса SerialBatch.
+ * Флаг CompressedFrame включает сжатие сообщения, оно сериализуется в повторно используемое окно вызывающего потока
+ * и сжимается оттуда непосредственно в массив байт.
+ * \param bytes Ссылка на массив байт.
+ * \param value Структура данных.
+ * \param flags Пользовательские флаги кадра.
+ * \throw SerialException В случае переполнения динамического массива или длины кадра.
+ */
+template< typename ByteArray = std::string, typename T >
+void append( ByteArray& bytes, const T& value, uint8_t flags = 0 );
+
+/**
+ * \~english
+ * \brief Writes structured data in serialized form to the output sink.
+ * Peak memory usage is bounded by the sink buffer, the output is identical to serialize().
+ * \param sink Output sink.
+ * \param value Data structure.
+ * \throw SerialException In case of dynamic array overflow, the sink may receive partial data.
+ * \~russian
+ * \brief Записывает структуру данных в сериализованном виде в приемник вывода.
+ * Пиковый расход памяти ограничен буфером приемника, вывод идентичен serialize().
+ * \param sink Приемник вывода.
+ * \param value Структура данных.
+ * \throw SerialException В случае переполнения динамического массива, приемник может получить часть данных.
+ */
+template< SerialEndian endian = DefaultEndian, typename T >
+void write( SerialSink& sink, const T& value );
+
 /**
  * \~english
  * \brief Returns serialized data in structured form.
@@ -74,6 +178,122 @@ T parse( const ByteArray& bytes );
 template< typename T, typename ByteArray = std::string >
 void parse( T& value, const ByteArray& bytes );
 
+/**
+ * \~english
+ * \brief Returns serialized data in structured form, vectors with offset index are decoded in parallel.
+ * Chunks of elements listed in the index of a vector are decoded by the tasks of the executor,
+ * vectors without index are decoded sequentially.
+ * \param value Reference to data structure.
+ * \param bytes Byte array.
+ * \param executor Executor of parallel tasks.
+ * \throw SerialException In case of invalid data.
+ * \~russian
+ * \brief Возвращает сериализованные данные в структурированном виде, векторы с индексом смещений разбираются параллельно.
+ * Части элементов, перечисленные в индексе вектора, разбираются задачами исполнителя,
+ * векторы без индекса разбираются последовательно.
+ * \param value Ссылка на структуру данных.
+ * \param bytes Массив байт.
+ * \param executor Исполнитель параллельных задач.
+ * \throw SerialException В случае некорректных данных.
+ */
+template< typename T, typename ByteArray = std::string >
+void parse( T& value, const ByteArray& bytes, SerialExecutor& executor );
+
+/**
+ * \~english
+ * \brief Returns the listed fields of serialized data in structured form, other fields keep their values.
+ * Fields before the listed ones are skipped by their sizes and length prefixes without allocations,
+ * fields after the last listed one are not read.
+ * \param value Reference to data structure.
+ * \param bytes Byte array.
+ * \throw SerialException In case of invalid data.
+ * \~russian
+ * \brief Возвращает перечисленные поля сериализованных данных в структурированном виде, остальные поля сохраняют свои значения.
+ * Поля перед перечисленными пропускаются по их размерам и префиксам длины без выделения памяти,
+ * поля после последнего перечисленного не читаются.
+ * \param value Ссылка на структуру данных.
+ * \param bytes Массив байт.
+ * \throw SerialException В случае некорректных данных.
+ */
+template< typename T, std::size_t ... Index, typename ByteArray >
+void parse_fields( T& value, const ByteArray& bytes );
+
+/**
+ * \~english
+ * \brief Returns the listed fields of serialized data in structured form, other fields are value-initialized.
+ * \param bytes Byte array.
+ * \return Data structure with the listed fields recovered from a set of bytes.
+ * \throw SerialException In case of invalid data.
+ * \~russian
+ * \brief Возвращает перечисленные поля сериализованных данных в структурированном виде, остальные поля инициализируются по умолчанию.
+ * \param bytes Массив байт.
+ * \return Структура данных с перечисленными полями, восстановленными из набора байт.
+ * \throw SerialException В случае некорректных данных.
+ */
+template< typename T, std::size_t ... Index, typename ByteArray >
+T parse_fields( const ByteArray& bytes );
+
+#if defined( SERIAL_MEMORY_RESOURCE )
+
+/**
+ * \~english
+ * \brief Returns serialized data in structured form, allocating polymorphic containers from the memory resource.
+ * Every std::pmr container of the structure, including nested ones, uses the resource,
+ * so the whole structure can be released at once with the resource.
+ * \param bytes Byte array.
+ * \param resource Memory resource.
+ * \return Original data structure recovered from a set of bytes.
+ * \throw SerialException In case of invalid data.
+ * \~russian
+ * \brief Возвращает сериализованные данные в структурированном виде, размещая полиморфные контейнеры в ресурсе памяти.
+ * Все контейнеры std::pmr структуры, включая вложенные, используют ресурс,
+ * поэтому вся структура может быть освобождена вместе с ресурсом.
+ * \param bytes Массив байт.
+ * \param resource Ресурс памяти.
+ * \return Исходная структура данных, восстановленная из набора байт.
+ * \throw SerialException В случае некорректных данных.
+ */
+template< typename T, typename ByteArray = std::string >
+T parse( const ByteArray& bytes, std::pmr::memory_resource* resource );
+
+/**
+ * \~english
+ * \brief Returns serialized data in structured form, allocating polymorphic containers from the memory resource.
+ * \param value Reference to data structure.
+ * \param bytes Byte array.
+ * \param resource Memory resource.
+ * \throw SerialException In case of invalid data.
+ * \~russian
+ * \brief Возвращает сериализованные данные в структурированном виде, размещая полиморфные контейнеры в ресурсе памяти.
+ * \param value Ссылка на структуру данных.
+ * \param bytes Массив байт.
+ * \param resource Ресурс памяти.
+ * \throw SerialException В случае некорректных данных.
+ */
+template< typename T, typename ByteArray = std::string >
+void parse( T& value, const ByteArray& bytes, std::pmr::memory_resource* resource );
+
+#endif
+
+/**
+ * \~english
+ * \brief Returns read-only view of the serialized data without decoding it.
+ * Strings and primitive arrays are accessed in place, nested structures are accessed by field index.
+ * The view refers to the byte array, which must outlive it.
+ * \param bytes Byte array.
+ * \return Lazy accessor of the original data structure.
+ * \throw SerialException In case of invalid data.
+ * \~russian
+ * \brief Возвращает представление сериализованных данных только для чтения без их декодирования.
+ * Строки и массивы примитивов доступны на месте, вложенные структуры доступны по индексу поля.
+ * Представление ссылается на массив байт, который должен существовать дольше него.
+ * \param bytes Массив байт.
+ * \return Ленивый метод доступа к исходной структуре данных.
+ * \throw SerialException В случае некорректных данных.
+ */
+template< typename T, typename ByteArray = std::string >
+auto view( const ByteArray& bytes );
+
 /**
  * \~english
  * \brief Returns least size of the serialized data.
@@ -98,6 +318,26 @@ uint64_t size();
 template< typename T >
 uint64_t size( const T& value );
 
+/**
+ * \~english
+ * \brief Checks whether the size of serialized data is known at compile time.
+ * \~russian
+ * \brief Проверяет, известен ли размер сериализованных данных на этапе компиляции.
+ */
+template< typename T >
+constexpr bool fixed();
+
+/**
+ * \~english
+ * \brief Returns size of the serialized data of fixed size type at compile time.
+ * \return Bytes count.
+ * \~russian
+ * \brief Возвращает размер сериализованных данных типа фиксированного размера на этапе компиляции.
+ * \return Количество байт.
+ */
+template< typename T >
+constexpr std::size_t fixed_size();
+
 /**
  * \~english
  * \brief Returns identifier from the serialized data.
@@ -0,0 +1,93 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <cstdio>
+
+/**
+ * Messages with checksum trailer are written into arrays of exact and larger size and read back.
+ */
+struct Row {
+    std::string name;
+    std::vector< int64_t > ids;
+    uint32_t kind;
+};
+
+SERIAL_TYPE_INFO( Row )
+
+using namespace memserial;
+
+static int failures = 0;
+
+#define CHECK( condition ) \
+    do { \
+        if ( !( condition ) ) { \
+            std::printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition ); \
+            ++failures; \
+        } \
+    } while ( 0 )
+
+template< typename Function >
+static int code( Function function ) {
+
+    try {
+        function();
+    }
+    catch ( const SerialException& exception ) {
+        return exception.code();
+    }
+
+    return -1;
+}
+
+template< typename ByteArray >
+static void check( const Row& row ) {
+
+    ByteArray bytes = serialize< ByteArray >( row );
+    CHECK( parse< Row >( bytes ).ids == row.ids );
+
+    ByteArray exact;
+    exact.resize( bytes.size() );
+    serialize( exact, row );
+    CHECK( exact == bytes );
+
+    ByteArray larger;
+    larger.resize( bytes.size() + 16 );
+    CHECK( code( [ & ] { serialize( larger, row ); } ) == SerialException::ExcBufferOverflow );
+
+    ByteArray smaller;
+    smaller.resize( bytes.size() - 1 );
+    CHECK( code( [ & ] { serialize( smaller, row ); } ) == SerialException::ExcBufferOverflow );
+
+    ByteArray corrupted = bytes;
+    corrupted[ corrupted.size() / 2 ] ^= 1;
+    CHECK( code( [ & ] { parse< Row >( corrupted ); } ) == SerialException::ExcChecksumMismatch );
+}
+
+int main() {
+
+    Row row{ "row", { 1, -2, 300000, 4 }, 7 };
+
+    check< CheckedWrapper< NativeEndian > >( row );
+    check< CheckedWrapper< BigEndian > >( row );
+    check< CheckedWrapper< LittleEndian, CompactEncoding > >( row );
+
+    std::string plain;
+    plain.resize( size( row ) + 16 );
+    serialize( plain, row );
+    CHECK( parse< Row >( plain ).kind == row.kind );
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <cstdio>
+
+/**
+ * Messages read in the other encoding are reported as incompatible encoding even if they are shorter
+ * than the least size of the type in the requested encoding.
+ */
+struct Short {
+    int8_t flag;
+    std::string name;
+};
+
+SERIAL_TYPE_INFO( Short )
+
+using namespace memserial;
+
+static int failures = 0;
+
+#define CHECK( condition ) \
+    do { \
+        if ( !( condition ) ) { \
+            std::printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition ); \
+            ++failures; \
+        } \
+    } while ( 0 )
+
+template< typename Function >
+static int code( Function function ) {
+
+    try {
+        function();
+    }
+    catch ( const SerialException& exception ) {
+        return exception.code();
+    }
+
+    return -1;
+}
+
+int main() {
+
+    const Short value{ 1, "" };
+
+    CompactWrapper<> compact = serialize< CompactWrapper<> >( value );
+    std::string fixed( compact.begin(), compact.end() );
+    CHECK( fixed.size() < size< Short >() );
+
+    CHECK( code( [ & ] { parse< Short >( fixed ); } ) == SerialException::ExcEncodingIncompatible );
+    CHECK( code( [ & ] { parse_fields< Short, 0 >( fixed ); } ) == SerialException::ExcEncodingIncompatible );
+    CHECK( code( [ & ] { view< Short >( fixed ); } ) == SerialException::ExcEncodingIncompatible );
+    CHECK( parse< Short >( compact ).flag == 1 );
+
+    std::string bytes = serialize( value );
+    CompactWrapper<> wrong( bytes.begin(), bytes.end() );
+    CHECK( code( [ & ] { parse< Short >( wrong ); } ) == SerialException::ExcEncodingIncompatible );
+
+    std::string truncated = bytes.substr( 0, bytes.size() - 1 );
+    CHECK( code( [ & ] { parse< Short >( truncated ); } ) == SerialException::ExcBufferOverflow );
+    CHECK( code( [ & ] { view< Short >( truncated ); } ) == SerialException::ExcBufferOverflow );
+
+    std::string header = bytes.substr( 0, 4 );
+    CHECK( code( [ & ] { parse< Short >( header ); } ) == SerialException::ExcBufferOverflow );
+
+    return failures == 0 ? 0 : 1;
+}
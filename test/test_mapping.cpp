@@ -0,0 +1,93 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <cstdio>
+#include <fstream>
+
+/**
+ * Frames written to a file are read back through a batch over the mapped file.
+ */
+struct Record {
+    uint32_t id;
+    std::string name;
+    std::vector< double > values;
+};
+
+SERIAL_TYPE_INFO( Record )
+
+using namespace memserial;
+
+static int failures = 0;
+
+#define CHECK( condition ) \
+    do { \
+        if ( !( condition ) ) { \
+            std::printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition ); \
+            ++failures; \
+        } \
+    } while ( 0 )
+
+static Record record( uint32_t id ) {
+    return Record{ id, "record" + std::to_string( id ), std::vector< double >( id % 7, id * 0.5 ) };
+}
+
+int main() {
+
+    const char* path = "test_mapping.bin";
+    const uint32_t count = 1000;
+
+    {
+        std::string bytes;
+        for ( uint32_t id = 0; id < count; ++id )
+            append( bytes, record( id ), id % 2 ? uint8_t( CompressedFrame ) : uint8_t( 0 ) );
+        std::ofstream( path, std::ios::binary ) << bytes;
+    }
+
+    {
+        SerialMapping mapping( path );
+        SerialView bytes = mapping.view();
+        SerialBatch< SerialView > batch( bytes );
+
+        uint32_t id = 0;
+        for ( const auto& frame : batch ) {
+            CHECK( frame.hash() == ident< Record >() );
+            CHECK( frame.compressed() == ( id % 2 != 0 ) );
+
+            Record value = parse< Record >( frame.bytes() );
+            CHECK( value.id == id );
+            CHECK( value.name == record( id ).name );
+            CHECK( value.values == record( id ).values );
+            ++id;
+        }
+
+        CHECK( id == count );
+    }
+
+    {
+        SerialMapping mapping( path );
+        std::size_t first = SerialFrame<>::header_size + size( record( 0 ) );
+        SerialView bytes = mapping.view( first );
+
+        uint32_t id = 1;
+        for ( const auto& frame : SerialBatch< SerialView >( bytes ) )
+            CHECK( parse< Record >( frame.bytes() ).id == id++ );
+
+        CHECK( id == count );
+    }
+
+    std::remove( path );
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+// Copyright 2019 Ilya Kiselev.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serial_forward.h"
+
+#include <cstdio>
+
+/**
+ * Large arrays written with an executor match the sequential output and the byte array size is checked
+ * as without executor.
+ */
+struct Entry {
+    std::string name;
+    std::vector< int32_t > values;
+};
+
+struct Journal {
+    std::vector< Entry > entries;
+};
+
+SERIAL_TYPE_INFO( Entry )
+SERIAL_TYPE_INFO( Journal )
+
+using namespace memserial;
+
+static int failures = 0;
+
+#define CHECK( condition ) \
+    do { \
+        if ( !( condition ) ) { \
+            std::printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition ); \
+            ++failures; \
+        } \
+    } while ( 0 )
+
+template< typename Function >
+static int code( Function function ) {
+
+    try {
+        function();
+    }
+    catch ( const SerialException& exception ) {
+        return exception.code();
+    }
+
+    return -1;
+}
+
+template< typename ByteArray >
+static void check( const Journal& journal, SerialExecutor& executor, bool checked ) {
+
+    ByteArray sequential = serialize< ByteArray >( journal );
+
+    ByteArray exact;
+    exact.resize( sequential.size() );
+    serialize( exact, journal, executor );
+    CHECK( exact == sequential );
+
+    ByteArray larger;
+    larger.resize( sequential.size() + 16 );
+    int larger_code = code( [ & ] { serialize( larger, journal, executor ); } );
+    CHECK( larger_code == ( checked ? SerialException::ExcBufferOverflow : -1 ) );
+
+    ByteArray smaller;
+    smaller.resize( sequential.size() - 1 );
+    CHECK( code( [ & ] { serialize( smaller, journal, executor ); } ) == SerialException::ExcBufferOverflow );
+}
+
+int main() {
+
+    Journal journal;
+
+    for ( int32_t index = 0; index < 20000; ++index )
+        journal.entries.push_back( Entry{ "entry" + std::to_string( index ), std::vector< int32_t >( index % 5, index ) } );
+
+    SerialThreadExecutor executor( 4 );
+
+    check< std::string >( journal, executor, false );
+    check< SerialWrapper< std::string, BigEndian > >( journal, executor, false );
+    check< CompactWrapper<> >( journal, executor, false );
+    check< CheckedWrapper< LittleEndian, CompactEncoding > >( journal, executor, true );
+
+    return failures == 0 ? 0 : 1;
+}